@@ -0,0 +1,48 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef BENCH_BENCH_HPP_
+#define BENCH_BENCH_HPP_
+
+// Minimal benchmark helpers (no external dependencies)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <string>
+
+namespace bench {
+
+// prevents the compiler from optimizing away a computed value
+template <typename T>
+inline void do_not_optimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// best wall time (in ms) of 'reps' executions of f()
+template <typename F>
+double time_ms(F&& f, int reps = 5) {
+  double best = std::numeric_limits<double>::max();
+  for (int r = 0; r < reps; r++) {
+    auto t0 = std::chrono::steady_clock::now();
+    f();
+    auto t1 = std::chrono::steady_clock::now();
+    best = std::min(
+        best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+  }
+  return best;
+}
+
+inline void report(const std::string& name, double ms) {
+  std::printf("%-48s %10.3f ms\n", name.c_str(), ms);
+}
+
+inline void report(const std::string& name, double ms, double baseline_ms) {
+  std::printf("%-48s %10.3f ms  (x%.2f)\n", name.c_str(), ms,
+              baseline_ms / ms);
+}
+
+}  // namespace bench
+
+#endif  // BENCH_BENCH_HPP_
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Per-request allocation pattern: each request builds a few small vectors,
+// takes subvectors and as_copy() of them, then drops everything.
+// Default allocator (one malloc/free per vector) against bump_arena
+// (reset() per request), pool_arena and std::pmr::monotonic_buffer_resource.
+// Note: for large payloads element copies dominate, and libstdc++ only uses
+// memmove for std::allocator (other allocators copy element-wise).
+
+#include <cstddef>
+#include <iostream>
+#include <memory_resource>
+#include <vector>
+//
+#include <view_wrapper/Range.hpp>
+#include <view_wrapper/arena.hpp>
+#include <view_wrapper/subvector.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::arena_allocator;
+using view_wrapper::bump_arena;
+using view_wrapper::pool_allocator;
+using view_wrapper::pool_arena;
+using view_wrapper::Range;
+using view_wrapper::subvector;
+
+const std::size_t requests = 20'000;
+const std::size_t vectors_per_request = 64;
+const std::size_t elements = 8;
+
+// one request: build small vectors through subvector, copy their middle
+template <typename A>
+std::size_t request(const A& alloc, const std::vector<int>& input) {
+  std::size_t total = 0;
+  for (std::size_t k = 0; k < vectors_per_request; k++) {
+    std::vector<int, A> v(alloc);
+    subvector<int, A> sv(v);
+    sv.append_range(input);
+    sv.push_back(int(k));
+    Range<std::vector<int, A>> r(v);
+    auto copy = r->slice(elements / 4, 3 * elements / 4).as_copy();
+    total += copy.size() + std::size_t(copy[0]);
+  }
+  return total;
+}
+
+int main() {
+  std::vector<int> input(elements);
+  for (std::size_t i = 0; i < elements; i++) input[i] = int(i);
+
+  double t_default = bench::time_ms([&] {
+    std::size_t sum = 0;
+    for (std::size_t r = 0; r < requests; r++)
+      sum += request(std::allocator<int>(), input);
+    bench::do_not_optimize(sum);
+  });
+
+  bump_arena arena;
+  double t_bump = bench::time_ms([&] {
+    std::size_t sum = 0;
+    for (std::size_t r = 0; r < requests; r++) {
+      sum += request(arena_allocator<int>(arena), input);
+      arena.reset();
+    }
+    bench::do_not_optimize(sum);
+  });
+
+  pool_arena pool;
+  double t_pool = bench::time_ms([&] {
+    std::size_t sum = 0;
+    for (std::size_t r = 0; r < requests; r++)
+      sum += request(pool_allocator<int>(pool), input);
+    bench::do_not_optimize(sum);
+  });
+
+  double t_pmr = bench::time_ms([&] {
+    std::size_t sum = 0;
+    for (std::size_t r = 0; r < requests; r++) {
+      std::pmr::monotonic_buffer_resource mbr;
+      sum += request(std::pmr::polymorphic_allocator<int>(&mbr), input);
+    }
+    bench::do_not_optimize(sum);
+  });
+
+  bench::report("std::allocator", t_default);
+  bench::report("arena_allocator (bump_arena, reset per request)", t_bump,
+                t_default);
+  bench::report("pool_allocator (pool_arena)", t_pool, t_default);
+  bench::report("std::pmr::monotonic_buffer_resource", t_pmr, t_default);
+  std::cout << "bump_arena capacity: " << arena.capacity() / 1024 << " KB"
+            << std::endl;
+  std::cout << "pool_arena capacity: " << pool.capacity() / 1024 << " KB"
+            << std::endl;
+  return 0;
+}
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Sustained throughput (MB/s) and peak memory of counting records in a
+// large newline-delimited file: whole file read into a std::string,
+// against chunked_reader windows (with and without background prefetch).
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+//
+#include <view_wrapper/chunked_reader.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::chunked_reader;
+
+// peak resident set size (kB), from /proc/self/status
+long peak_rss_kb() {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line))
+    if (line.rfind("VmHWM:", 0) == 0) return std::stol(line.substr(6));
+  return -1;
+}
+
+// resets peak RSS (Linux only: writes 5 to /proc/self/clear_refs)
+void reset_peak_rss() { std::ofstream("/proc/self/clear_refs") << "5"; }
+
+int main() {
+  const std::size_t mb = 256;
+  auto path =
+      (std::filesystem::temp_directory_path() / "vw_bench_chunked.txt")
+          .string();
+  {
+    std::ofstream out(path, std::ios::binary);
+    std::string line = "0123456789,abcdefghij,klmnopqrst,uvwxyz,ABCDEFGHIJ\n";
+    for (std::size_t n = 0; n < mb * 1024 * 1024; n += line.size()) out << line;
+  }
+  const double size_mb =
+      double(std::filesystem::file_size(path)) / (1024.0 * 1024.0);
+
+  auto throughput = [&](const std::string& name, double ms, long peak_kb) {
+    bench::report(name, ms);
+    std::printf("    %.0f MB/s, peak RSS %ld MB\n", size_mb / (ms / 1000.0),
+                peak_kb / 1024);
+  };
+
+  std::size_t chunk_sizes[] = {1 << 16, 1 << 20, 1 << 22};
+  for (bool prefetch : {false, true}) {
+    for (std::size_t chunk : chunk_sizes) {
+      reset_peak_rss();
+      std::size_t lines = 0;
+      double ms = bench::time_ms([&] {
+        chunked_reader reader(path, chunk, '\n', prefetch);
+        lines = 0;
+        for (auto w : reader) lines += std::ranges::count(*w, '\n');
+      });
+      bench::do_not_optimize(lines);
+      throughput("chunked_reader " + std::to_string(chunk >> 10) + " KB" +
+                     (prefetch ? " (prefetch)" : ""),
+                 ms, peak_rss_kb());
+    }
+  }
+
+  reset_peak_rss();
+  double ms = bench::time_ms([&] {
+    std::ifstream in(path, std::ios::binary);
+    std::string s(std::filesystem::file_size(path), '\0');
+    in.read(s.data(), static_cast<std::streamsize>(s.size()));
+    bench::do_not_optimize(std::ranges::count(s, '\n'));
+  });
+  throughput("read into std::string", ms, peak_rss_kb());
+
+  std::remove(path.c_str());
+  return 0;
+}
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Multi-producer append throughput: P threads append n/P elements each to
+// one shared output, via concurrent_segmented_vector appenders (lock-free
+// block claims), against a mutex-protected std::vector (baseline).
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+//
+#include <view_wrapper/concurrent_segmented_vector.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::concurrent_segmented_vector;
+
+template <typename F>
+void run_threads(std::size_t p, F f) {
+  std::vector<std::thread> pool;
+  for (std::size_t t = 0; t < p; t++) pool.emplace_back(f, t);
+  for (auto& th : pool) th.join();
+}
+
+int main() {
+  const std::size_t n = 8'000'000;
+  const std::size_t block = 4096;
+  std::size_t max_threads =
+      std::max<std::size_t>(4, std::thread::hardware_concurrency());
+  std::cout << "hardware threads: " << std::thread::hardware_concurrency()
+            << std::endl;
+
+  for (std::size_t p = 1; p <= max_threads; p *= 2) {
+    const std::size_t per = n / p;
+
+    double t_mutex = bench::time_ms([&] {
+      std::vector<std::uint64_t> out;
+      out.reserve(n);
+      std::mutex m;
+      run_threads(p, [&](std::size_t t) {
+        for (std::size_t i = 0; i < per; i++) {
+          std::lock_guard<std::mutex> lock(m);
+          out.push_back(t * per + i);
+        }
+      });
+      bench::do_not_optimize(out.data());
+    });
+
+    auto fill = [&](concurrent_segmented_vector<std::uint64_t>& out) {
+      run_threads(p, [&](std::size_t t) {
+        auto app = out.appender();
+        for (std::size_t i = 0; i < per; i++) app.push_back(t * per + i);
+      });
+    };
+
+    double t_seg = bench::time_ms([&] {
+      concurrent_segmented_vector<std::uint64_t> out(n + p * block, block);
+      fill(out);
+      bench::do_not_optimize(out.size());
+    });
+
+    concurrent_segmented_vector<std::uint64_t> filled(n + p * block, block);
+    fill(filled);
+    double t_compact = bench::time_ms(
+        [&] {
+          auto dense = filled.compact();
+          bench::do_not_optimize(dense.data());
+        },
+        1);
+
+    std::string sp = std::to_string(p);
+    bench::report("mutex std::vector push_back (" + sp + " thr)", t_mutex);
+    bench::report("concurrent_segmented_vector (" + sp + " thr)",
+                  t_seg, t_mutex);
+    bench::report("  + compact() to dense vector", t_compact);
+  }
+  return 0;
+}
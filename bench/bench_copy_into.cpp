@@ -0,0 +1,136 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Materialization in a request loop: allocations per call and ns per call
+// of as_copy() (fresh container, baseline), copy_into(container) (reused
+// capacity) and copy_into(pointer) (memcpy into caller buffer), for
+// View<std::string>, View<std::vector<int>> and subvector<int>.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <numeric>
+#include <string>
+#include <vector>
+//
+#include <view_wrapper/View.hpp>
+#include <view_wrapper/subvector.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::subvector;
+using view_wrapper::View;
+
+static std::uint64_t allocations = 0;
+
+void* operator new(std::size_t n) {
+  allocations++;
+  if (void* p = std::malloc(n ? n : 1)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+const std::size_t calls = 1'000'000;
+
+// reports ns per call and allocations per call of f()
+template <typename F>
+double measure(const std::string& name, F f, double baseline_ns = 0) {
+  std::uint64_t before = allocations;
+  f();
+  double per_alloc = double(allocations - before) / double(calls);
+  double ms = bench::time_ms(f);
+  double ns = ms * 1e6 / double(calls);
+  if (baseline_ns > 0)
+    std::printf("%-44s %8.2f ns/call %6.2f allocs/call  (x%.2f)\n",
+                name.c_str(), ns, per_alloc, baseline_ns / ns);
+  else
+    std::printf("%-44s %8.2f ns/call %6.2f allocs/call\n", name.c_str(), ns,
+                per_alloc);
+  return ns;
+}
+
+int main() {
+  // === View<std::string> (256 bytes, beyond SSO) ===
+  std::string s(256, 'x');
+  View<std::string> vs(s);
+  double base = measure("View<string>::as_copy()", [&] {
+    for (std::size_t i = 0; i < calls; i++) {
+      std::string c = vs.as_copy();
+      bench::do_not_optimize(c.data());
+    }
+  });
+  std::string sbuf;
+  measure(
+      "View<string>::copy_into(string&)",
+      [&] {
+        for (std::size_t i = 0; i < calls; i++) {
+          vs.copy_into(sbuf);
+          bench::do_not_optimize(sbuf.data());
+        }
+      },
+      base);
+  std::vector<char> raw(256);
+  measure(
+      "View<string>::copy_into(char*)",
+      [&] {
+        for (std::size_t i = 0; i < calls; i++) {
+          vs.copy_into(raw.data());
+          bench::do_not_optimize(raw.data());
+        }
+      },
+      base);
+
+  // === View<std::vector<int>> (64 ints) ===
+  std::vector<int> v(64);
+  std::iota(v.begin(), v.end(), 0);
+  View<std::vector<int>> vv(v);
+  base = measure("View<vector<int>>::as_copy()", [&] {
+    for (std::size_t i = 0; i < calls; i++) {
+      std::vector<int> c = vv.as_copy();
+      bench::do_not_optimize(c.data());
+    }
+  });
+  std::vector<int> vbuf;
+  measure(
+      "View<vector<int>>::copy_into(vector&)",
+      [&] {
+        for (std::size_t i = 0; i < calls; i++) {
+          vv.copy_into(vbuf);
+          bench::do_not_optimize(vbuf.data());
+        }
+      },
+      base);
+
+  // === subvector<int> (window of 64 ints) ===
+  std::vector<int> big(4096);
+  std::iota(big.begin(), big.end(), 0);
+  subvector<int> sv(big, 1024, 1088);
+  base = measure("subvector<int>::as_copy()", [&] {
+    for (std::size_t i = 0; i < calls; i++) {
+      std::vector<int> c = sv.as_copy();
+      bench::do_not_optimize(c.data());
+    }
+  });
+  measure(
+      "subvector<int>::copy_into(vector&)",
+      [&] {
+        for (std::size_t i = 0; i < calls; i++) {
+          sv.copy_into(vbuf);
+          bench::do_not_optimize(vbuf.data());
+        }
+      },
+      base);
+  std::vector<int> ibuf(64);
+  measure(
+      "subvector<int>::copy_into(int*)",
+      [&] {
+        for (std::size_t i = 0; i < calls; i++) {
+          sv.copy_into(ibuf.data());
+          bench::do_not_optimize(ibuf.data());
+        }
+      },
+      base);
+  return 0;
+}
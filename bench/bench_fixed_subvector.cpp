@@ -0,0 +1,80 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Compares std::vector<subvector<int>> against
+// std::vector<fixed_subvector<int>> on outer-vector reallocation
+// (push_back without reserve) and iteration.
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+//
+#include <view_wrapper/subvector.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::fixed_subvector;
+using view_wrapper::subvector;
+
+template <typename SV>
+std::vector<SV> build(std::vector<int>& remote, std::size_t count,
+                      std::size_t width) {
+  std::vector<SV> out;  // no reserve: measures reallocation copies
+  for (std::size_t i = 0; i < count; i++) {
+    std::size_t b = (i * width) % (remote.size() - width);
+    out.push_back(SV(remote, b, b + width));
+  }
+  return out;
+}
+
+template <typename SV>
+long long iterate(const std::vector<SV>& all) {
+  long long sum = 0;
+  for (const auto& sv : all)
+    for (auto x : sv) sum += x;
+  return sum;
+}
+
+int main() {
+  const std::size_t count = 2'000'000;
+  const std::size_t width = 8;
+  std::vector<int> remote(1 << 16);
+  for (std::size_t i = 0; i < remote.size(); i++) remote[i] = int(i % 7);
+
+  std::cout << "sizeof(subvector<int>) = " << sizeof(subvector<int>)
+            << std::endl;
+  std::cout << "sizeof(fixed_subvector<int>) = " << sizeof(fixed_subvector<int>)
+            << std::endl;
+  std::cout << "sizeof(fixed_subvector<int, A, uint64_t>) = "
+            << sizeof(fixed_subvector<int, std::allocator<int>, std::uint64_t>)
+            << std::endl;
+
+  using fixed64 = fixed_subvector<int, std::allocator<int>, std::uint64_t>;
+  double t_sv = bench::time_ms([&] {
+    auto all = build<subvector<int>>(remote, count, width);
+    bench::do_not_optimize(all.data());
+  });
+  double t_fx = bench::time_ms([&] {
+    auto all = build<fixed_subvector<int>>(remote, count, width);
+    bench::do_not_optimize(all.data());
+  });
+  double t_fx64 = bench::time_ms([&] {
+    auto all = build<fixed64>(remote, count, width);
+    bench::do_not_optimize(all.data());
+  });
+  bench::report("build+realloc subvector<int>", t_sv);
+  bench::report("build+realloc fixed_subvector<int>", t_fx, t_sv);
+  bench::report("build+realloc fixed_subvector<int,A,u64>", t_fx64, t_sv);
+
+  auto all_sv = build<subvector<int>>(remote, count, width);
+  auto all_fx = build<fixed_subvector<int>>(remote, count, width);
+  double i_sv =
+      bench::time_ms([&] { bench::do_not_optimize(iterate(all_sv)); });
+  double i_fx =
+      bench::time_ms([&] { bench::do_not_optimize(iterate(all_fx)); });
+  bench::report("iterate subvector<int>", i_sv);
+  bench::report("iterate fixed_subvector<int>", i_fx, i_sv);
+
+  return 0;
+}
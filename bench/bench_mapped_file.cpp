@@ -0,0 +1,111 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Time-to-first-byte, full scan time and resident memory (RSS) of a large
+// file read into a std::string, against View<mapped_file> (mmap).
+// Note that mapped pages count in RSS once touched, but are backed by the
+// page cache (no private copy), and are never all resident before use.
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+//
+#include <view_wrapper/mapped_file.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::access_hint;
+using view_wrapper::mapped_file;
+using view_wrapper::View;
+
+// current resident set size (kB), from /proc/self/status
+long rss_kb() {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line))
+    if (line.rfind("VmRSS:", 0) == 0) return std::stol(line.substr(6));
+  return -1;
+}
+
+std::string read_all(const std::string& path) {
+  std::ifstream in(path, std::ios::binary);
+  std::string s;
+  in.seekg(0, std::ios::end);
+  s.resize(static_cast<std::size_t>(in.tellg()));
+  in.seekg(0);
+  in.read(s.data(), static_cast<std::streamsize>(s.size()));
+  return s;
+}
+
+int main() {
+  const std::size_t mb = 256;
+  auto path =
+      (std::filesystem::temp_directory_path() / "vw_bench_mapped.txt").string();
+  {
+    std::ofstream out(path, std::ios::binary);
+    std::string line = "0123456789,abcdefghij,klmnopqrst,uvwxyz,ABCDEFGHIJ\n";
+    for (std::size_t n = 0; n < mb * 1024 * 1024; n += line.size()) out << line;
+  }
+
+  auto count_lines = [](std::string_view sv) {
+    return std::count(sv.begin(), sv.end(), '\n');
+  };
+
+  // time to first byte
+  double t_read_first = bench::time_ms([&] {
+    std::string s = read_all(path);
+    bench::do_not_optimize(s[0]);
+  });
+  double t_map_first = bench::time_ms([&] {
+    mapped_file f(path, access_hint::sequential);
+    View<mapped_file> v(f);
+    bench::do_not_optimize(v->front());
+  });
+  bench::report("first byte: read into std::string", t_read_first);
+  bench::report("first byte: View<mapped_file>", t_map_first, t_read_first);
+
+  // full scan (count lines)
+  double t_read_scan = bench::time_ms([&] {
+    std::string s = read_all(path);
+    bench::do_not_optimize(count_lines(s));
+  });
+  double t_map_scan = bench::time_ms([&] {
+    mapped_file f(path, access_hint::sequential);
+    View<mapped_file> v(f);
+    bench::do_not_optimize(count_lines(*v));
+  });
+  bench::report("full scan: read into std::string", t_read_scan);
+  bench::report("full scan: View<mapped_file>", t_map_scan, t_read_scan);
+
+  // resident memory while holding the data
+  long base = rss_kb();
+  long rss_first = 0;
+  long rss_scan = 0;
+  {
+    mapped_file f(path, access_hint::sequential);
+    View<mapped_file> v(f);
+    bench::do_not_optimize(v->front());
+    rss_first = rss_kb() - base;
+    bench::do_not_optimize(count_lines(*v));
+    rss_scan = rss_kb() - base;
+  }
+  long rss_string = 0;
+  {
+    std::string s = read_all(path);
+    rss_string = rss_kb() - base;
+    bench::do_not_optimize(s[0]);
+  }
+  std::cout << "RSS delta std::string:                " << rss_string / 1024
+            << " MB" << std::endl;
+  std::cout << "RSS delta mapped (first byte):        " << rss_first / 1024
+            << " MB" << std::endl;
+  std::cout << "RSS delta mapped (after scan, shared): " << rss_scan / 1024
+            << " MB" << std::endl;
+
+  std::remove(path.c_str());
+  return 0;
+}
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// md_view over a flat std::vector<float> matrix: transpose and column sums
+// (a reduction walking columns of a row-major matrix), with naive
+// traversal against tiled traversal (for_each_tile / for_each_tiled).
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+//
+#include <view_wrapper/md_view.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::md_view;
+
+int main() {
+  const std::size_t n = 2048;
+  // small transpose tiles: 8 KB row stride causes cache set conflicts
+  const std::size_t tile = 8;
+  const std::size_t block_rows = 32;
+  std::vector<float> a(n * n);
+  for (std::size_t i = 0; i < a.size(); i++) a[i] = float(i % 97);
+  std::vector<float> b(n * n);
+  md_view<float, 2> in(a, {n, n});
+  md_view<float, 2> out(b, {n, n});
+
+  // transpose: out(j, i) = in(i, j)
+  double t_naive = bench::time_ms([&] {
+    for (std::size_t i = 0; i < n; i++)
+      for (std::size_t j = 0; j < n; j++) out(j, i) = in(i, j);
+    bench::do_not_optimize(b[1]);
+  });
+  double t_tiled = bench::time_ms([&] {
+    in.for_each_tiled(tile, tile, [&](std::size_t i, std::size_t j,
+                                      float& x) { out(j, i) = x; });
+    bench::do_not_optimize(b[1]);
+  });
+  bench::report("transpose naive", t_naive);
+  bench::report("transpose tiled 8x8", t_tiled, t_naive);
+
+  // column sums: colsum[j] = sum_i in(i, j)
+  std::vector<double> colsum(n);
+  double t_cols = bench::time_ms([&] {
+    for (std::size_t j = 0; j < n; j++) {
+      double s = 0;
+      for (float x : in.col(j)) s += x;
+      colsum[j] = s;
+    }
+    bench::do_not_optimize(colsum[0]);
+  });
+  std::vector<double> colsum2(n);
+  double t_blocked = bench::time_ms([&] {
+    std::fill(colsum2.begin(), colsum2.end(), 0.0);
+    in.for_each_tile(block_rows, n, [&](md_view<float, 2> block) {
+      for (std::size_t i = 0; i < block.extent(0); i++) {
+        auto r = block.row(i);
+        for (std::size_t j = 0; j < block.extent(1); j++) colsum2[j] += r[j];
+      }
+    });
+    bench::do_not_optimize(colsum2[0]);
+  });
+  bench::report("column sums naive (col(j) traversal)", t_cols);
+  bench::report("column sums blocked (32-row tiles)", t_blocked, t_cols);
+  std::cout << "same result: "
+            << (std::abs(colsum[7] - colsum2[7]) < 1e-6 ? "yes" : "no")
+            << std::endl;
+  return 0;
+}
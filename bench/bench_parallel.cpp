@@ -0,0 +1,90 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Scaling of parallel_for_each/transform/reduce/sort over a subvector with
+// 1..N threads (N = hardware threads, at least 4), against the serial
+// std::ranges algorithm (baseline).
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+//
+#include <view_wrapper/parallel.hpp>
+#include <view_wrapper/subvector.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::parallel_for_each;
+using view_wrapper::parallel_reduce;
+using view_wrapper::parallel_sort;
+using view_wrapper::parallel_transform;
+using view_wrapper::subvector;
+using view_wrapper::thread_pool;
+
+int main() {
+  const std::size_t n = 4'000'000;
+  const std::size_t grain = 16'384;
+  std::size_t max_threads =
+      std::max<std::size_t>(4, std::thread::hardware_concurrency());
+  std::cout << "hardware threads: " << std::thread::hardware_concurrency()
+            << std::endl;
+
+  std::mt19937 rng(42);
+  std::vector<double> base(n);
+  for (auto& x : base) x = double(rng() % 1'000'000);
+  std::vector<double> out(n);
+
+  auto work = [](double x) { return std::sqrt(x) * 1.5 + std::sin(x); };
+
+  // baselines
+  std::vector<double> v = base;
+  double t_each = bench::time_ms([&] {
+    std::ranges::for_each(v, [&](double& x) { x = work(x); });
+  });
+  double t_transform =
+      bench::time_ms([&] { std::ranges::transform(base, out.begin(), work); });
+  double t_reduce = bench::time_ms([&] {
+    bench::do_not_optimize(std::accumulate(base.begin(), base.end(), 0.0));
+  });
+  double t_sort = bench::time_ms([&] {
+    v = base;
+    std::ranges::sort(v);
+  });
+  bench::report("std::ranges::for_each", t_each);
+  bench::report("std::ranges::transform", t_transform);
+  bench::report("std::accumulate", t_reduce);
+  bench::report("std::ranges::sort (with copy)", t_sort);
+
+  for (std::size_t t = 1; t <= max_threads; t *= 2) {
+    thread_pool pool(t);
+    subvector<double> sv(v);
+    subvector<double> sbase(base);
+    subvector<double> sout(out);
+    const std::string tag = " [" + std::to_string(t) + " threads]";
+
+    double p_each = bench::time_ms([&] {
+      parallel_for_each(sv, [&](double& x) { x = work(x); }, grain, pool);
+    });
+    double p_transform = bench::time_ms(
+        [&] { parallel_transform(sbase, sout, work, grain, pool); });
+    double p_reduce = bench::time_ms([&] {
+      bench::do_not_optimize(
+          parallel_reduce(sbase, 0.0, std::plus<>{}, grain, pool));
+    });
+    double p_sort = bench::time_ms([&] {
+      v = base;
+      parallel_sort(sv, std::less<>{}, grain, pool);
+    });
+    bench::report("parallel_for_each" + tag, p_each, t_each);
+    bench::report("parallel_transform" + tag, p_transform, t_transform);
+    bench::report("parallel_reduce" + tag, p_reduce, t_reduce);
+    bench::report("parallel_sort (with copy)" + tag, p_sort, t_sort);
+  }
+  return 0;
+}
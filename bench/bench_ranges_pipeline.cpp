@@ -0,0 +1,123 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// std::views pipelines (filter | transform) over View, Range and subvector
+// against the same pipeline over a raw std::span:
+// - one large scan (per-element cost of the pipeline);
+// - many pipelines over short slices (per-pipeline cost of the wrapper).
+// All of them are borrowed views, held by value in the pipeline (no
+// ref_view/owning_view), so timings should match the span baseline.
+//
+// Each pipeline compiles to the same loop as the span one (check with
+// g++ -O2 -S); built with -falign-loops=32, as otherwise loop placement
+// alone can make identical loops differ by up to 2x.
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+//
+#include <view_wrapper/Range.hpp>
+#include <view_wrapper/View.hpp>
+#include <view_wrapper/subvector.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::fixed_subvector;
+using view_wrapper::full_bounds;
+using view_wrapper::Range;
+using view_wrapper::subvector;
+using view_wrapper::View;
+
+using vec = std::vector<std::int64_t>;
+using full_subvector = subvector<std::int64_t, std::allocator<std::int64_t>,
+                                 full_bounds>;
+
+// no wrapper detour: views::all is the identity for every wrapper
+static_assert(std::is_same_v<std::views::all_t<View<vec>>, View<vec>>);
+static_assert(std::is_same_v<std::views::all_t<Range<vec>&>, Range<vec>>);
+static_assert(
+    std::is_same_v<std::views::all_t<full_subvector&>, full_subvector>);
+static_assert(std::is_same_v<std::views::all_t<fixed_subvector<std::int64_t>&>,
+                             fixed_subvector<std::int64_t>>);
+
+template <typename R>
+std::int64_t pipeline(R&& r) {
+  std::int64_t sum = 0;
+  for (std::int64_t x :
+       std::forward<R>(r) |
+           std::views::filter([](std::int64_t x) { return (x & 1) == 0; }) |
+           std::views::transform([](std::int64_t x) { return 3 * x; }))
+    sum += x;
+  return sum;
+}
+
+// best time of each case, measured in interleaved rounds (less sensitive
+// to frequency drift than measuring each case in one go)
+std::vector<double> interleaved(const std::vector<std::function<void()>>& fs,
+                                int rounds = 15) {
+  std::vector<double> best(fs.size(), 1e100);
+  for (int r = 0; r < rounds; r++)
+    for (std::size_t i = 0; i < fs.size(); i++)
+      best[i] = std::min(best[i], bench::time_ms(fs[i], 3));
+  return best;
+}
+
+int main() {
+  const std::size_t n = 1 << 20;
+  vec v(n);
+  std::iota(v.begin(), v.end(), 0);
+  Range<vec> range(v);
+
+  // === one large scan ===
+  auto scan = [&](auto make) -> std::function<void()> {
+    return [make] { bench::do_not_optimize(pipeline(make())); };
+  };
+  auto t = interleaved({
+      scan([&] { return std::span<std::int64_t>(v); }),
+      scan([&] { return View<vec>(v); }),
+      scan([&] { return range; }),
+      scan([&] { return full_subvector(v); }),
+      scan([&] { return fixed_subvector<std::int64_t>(v); }),
+      scan([&] { return subvector<std::int64_t>(v); }),
+  });
+  bench::report("span | filter | transform (1M)", t[0]);
+  bench::report("View | filter | transform", t[1], t[0]);
+  bench::report("Range | filter | transform", t[2], t[0]);
+  bench::report("subvector<full_bounds> | filter | transform", t[3], t[0]);
+  bench::report("fixed_subvector | filter | transform", t[4], t[0]);
+  bench::report("subvector (default policy) | ...", t[5], t[0]);
+
+  // === many pipelines over 16-element slices ===
+  const std::size_t w = 16;
+  auto slices = [&](auto make) -> std::function<void()> {
+    return [n, w, make] {
+      std::int64_t sum = 0;
+      for (std::size_t i = 0; i + w <= n; i += w) sum += pipeline(make(i));
+      bench::do_not_optimize(sum);
+    };
+  };
+  auto s = interleaved({
+      slices([&](std::size_t i) {
+        return std::span<std::int64_t>(v.data() + i, w);
+      }),
+      slices([&](std::size_t i) {
+        return fixed_subvector<std::int64_t>(v, i, i + w);
+      }),
+      slices([&](std::size_t i) {
+        return subvector<std::int64_t, std::allocator<std::int64_t>,
+                         view_wrapper::fixed_bounds>(v, i, i + w);
+      }),
+      slices(
+          [&](std::size_t i) { return subvector<std::int64_t>(v, i, i + w); }),
+  });
+  bench::report("span slices | filter | transform (64K x 16)", s[0]);
+  bench::report("fixed_subvector slices | ...", s[1], s[0]);
+  bench::report("subvector<fixed_bounds> slices | ...", s[2], s[0]);
+  bench::report("subvector (default policy) slices | ...", s[3], s[0]);
+  return 0;
+}
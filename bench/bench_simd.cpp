@@ -0,0 +1,78 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Speedup of view_wrapper::simd kernels (per isa level) against the
+// std::ranges / std equivalents, by element type and length.
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <vector>
+//
+#include <view_wrapper/View.hpp>
+#include <view_wrapper/simd.hpp>
+//
+#include "./bench.hpp"
+
+namespace simd = view_wrapper::simd;
+using view_wrapper::View;
+
+template <typename T>
+void run(const std::string& type, std::size_t n) {
+  std::vector<T> v(n);
+  for (std::size_t i = 0; i < n; i++) v[i] = T(int(i % 1000));
+  std::vector<T> w = v;
+  View<std::vector<T>> vv(v);
+  // same total work for every length
+  const std::size_t reps = std::max<std::size_t>(1, (1 << 24) / n);
+  const T missing = T(-1);
+  const std::string tag = type + " n=" + std::to_string(n);
+
+  auto measure = [&](auto&& f) {
+    return bench::time_ms([&] {
+      for (std::size_t r = 0; r < reps; r++) bench::do_not_optimize(f());
+    });
+  };
+
+  double b_sum =
+      measure([&] { return std::accumulate(v.begin(), v.end(), T{}); });
+  double b_min = measure([&] { return std::ranges::min(v); });
+  double b_count = measure([&] { return std::ranges::count(v, missing); });
+  double b_find = measure([&] { return std::ranges::find(v, missing); });
+  double b_equal = measure([&] { return std::ranges::equal(v, w); });
+  bench::report("std sum   " + tag, b_sum);
+  bench::report("std min   " + tag, b_min);
+  bench::report("std count " + tag, b_count);
+  bench::report("std find  " + tag, b_find);
+  bench::report("std equal " + tag, b_equal);
+
+  for (auto level : {simd::isa::sse2, simd::isa::avx2, simd::isa::avx512}) {
+    if (level > simd::detect_isa()) continue;
+    const std::string name = std::string(simd::isa_name(level)) + " ";
+    bench::report(name + "sum   " + tag,
+                  measure([&] { return simd::sum(vv, level); }), b_sum);
+    bench::report(name + "min   " + tag,
+                  measure([&] { return simd::min(vv, level); }), b_min);
+    bench::report(name + "count " + tag,
+                  measure([&] { return simd::count(vv, missing, level); }),
+                  b_count);
+    bench::report(name + "find  " + tag,
+                  measure([&] { return simd::find(vv, missing, level); }),
+                  b_find);
+    bench::report(name + "equal " + tag,
+                  measure([&] { return simd::equal(v, w, level); }), b_equal);
+  }
+}
+
+int main() {
+  std::cout << "detected isa: " << simd::isa_name(simd::detect_isa())
+            << std::endl;
+  for (std::size_t n : {64, 4096, 1 << 20}) {
+    run<std::int32_t>("int32", n);
+    run<float>("float", n);
+  }
+  return 0;
+}
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Interleaved appends into k segments of one vector:
+// subvector push_back over std::vector (via partitioned_vector, one tail
+// move per append) against slack_vector (amortized O(1) appends).
+
+#include <iostream>
+#include <string>
+#include <vector>
+//
+#include <view_wrapper/partitioned_vector.hpp>
+#include <view_wrapper/slack_vector.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::partitioned_vector;
+using view_wrapper::slack_vector;
+
+int main() {
+  for (std::size_t k : {4, 64}) {
+    const std::size_t per_seg = 100'000 / k;
+    const std::string tag = " k=" + std::to_string(k) +
+                            " n=" + std::to_string(k * per_seg);
+
+    double t_vec = bench::time_ms(
+        [&] {
+          partitioned_vector<int> pv(k);
+          std::vector<partitioned_vector<int>::segment_type> segs;
+          for (std::size_t s = 0; s < k; s++) segs.push_back(pv.segment(s));
+          for (std::size_t i = 0; i < per_seg; i++)
+            for (std::size_t s = 0; s < k; s++) segs[s].push_back(int(i));
+          bench::do_not_optimize(pv.as_vector().data());
+        },
+        3);
+    double t_slack = bench::time_ms(
+        [&] {
+          slack_vector<int> sv(k);
+          for (std::size_t i = 0; i < per_seg; i++)
+            for (std::size_t s = 0; s < k; s++) sv.segment(s).push_back(int(i));
+          bench::do_not_optimize(sv.size());
+        },
+        3);
+    bench::report("std::vector segments append" + tag, t_vec);
+    bench::report("slack_vector segments append" + tag, t_slack, t_vec);
+
+    slack_vector<int> sv(k);
+    for (std::size_t i = 0; i < per_seg; i++)
+      for (std::size_t s = 0; s < k; s++) sv.segment(s).push_back(int(i));
+    double t_iter = bench::time_ms([&] {
+      long long sum = 0;
+      sv.for_each([&sum](int x) { sum += x; });
+      bench::do_not_optimize(sum);
+    });
+    bench::report("slack_vector segmented iteration" + tag, t_iter);
+  }
+  return 0;
+}
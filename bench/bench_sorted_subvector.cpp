@@ -0,0 +1,134 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// sorted_subvector against std::set and a plain sorted std::vector:
+// - random lookups (ns/op), with and without the Eytzinger index;
+// - random single inserts (ns/op), and one bulk merge of the same batch.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <set>
+#include <vector>
+//
+#include <view_wrapper/sorted_subvector.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::sorted_subvector;
+
+static std::vector<std::uint32_t> random_keys(std::size_t n, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::vector<std::uint32_t> keys(n);
+  for (auto& k : keys) k = rng();
+  return keys;
+}
+
+static void report_ns(const char* name, double ms, std::size_t ops,
+                      double baseline_ms) {
+  std::printf("%-48s %8.1f ns/op  (x%.2f)\n", name, ms * 1e6 / ops,
+              baseline_ms / ms);
+}
+
+static void lookups(std::size_t n) {
+  const std::size_t q = 1 << 20;
+  auto keys = random_keys(n, 1);
+  // half of the queries hit
+  auto queries = random_keys(q, 2);
+  for (std::size_t i = 0; i < q; i += 2) queries[i] = keys[i % n];
+
+  std::set<std::uint32_t> set(keys.begin(), keys.end());
+  std::vector<std::uint32_t> sorted = keys;
+  std::sort(sorted.begin(), sorted.end());
+  std::vector<std::uint32_t> remote = keys;
+  sorted_subvector<std::uint32_t> seg(remote);
+
+  auto t_set = bench::time_ms([&] {
+    std::size_t hits = 0;
+    for (auto k : queries) hits += (set.find(k) != set.end());
+    bench::do_not_optimize(hits);
+  });
+  auto t_vec = bench::time_ms([&] {
+    std::size_t hits = 0;
+    for (auto k : queries) {
+      auto it = std::lower_bound(sorted.begin(), sorted.end(), k);
+      hits += (it != sorted.end() && *it == k);
+    }
+    bench::do_not_optimize(hits);
+  });
+  auto t_seg = bench::time_ms([&] {
+    std::size_t hits = 0;
+    for (auto k : queries) hits += seg.contains(k);
+    bench::do_not_optimize(hits);
+  });
+  seg.build_index();
+  auto t_index = bench::time_ms([&] {
+    std::size_t hits = 0;
+    for (auto k : queries) hits += seg.contains(k);
+    bench::do_not_optimize(hits);
+  });
+  std::printf("lookups, n = %zu (1M queries):\n", n);
+  report_ns("  std::set::find", t_set, q, t_set);
+  report_ns("  sorted vector std::lower_bound", t_vec, q, t_set);
+  report_ns("  sorted_subvector::contains", t_seg, q, t_set);
+  report_ns("  sorted_subvector::contains (Eytzinger index)", t_index, q,
+            t_set);
+}
+
+// best time of insert(structure) over 3 fresh structures (build not timed)
+template <typename Build, typename Insert>
+static double time_inserts(Build build, Insert insert) {
+  double best = 1e100;
+  for (int r = 0; r < 3; r++) {
+    auto st = build();
+    best = std::min(best, bench::time_ms([&] { insert(st); }, 1));
+    bench::do_not_optimize(st);
+  }
+  return best;
+}
+
+static void inserts(std::size_t n, std::size_t k) {
+  auto keys = random_keys(n, 3);
+  auto batch = random_keys(k, 4);
+  auto sorted_keys = keys;
+  std::sort(sorted_keys.begin(), sorted_keys.end());
+
+  auto t_set = time_inserts(
+      [&] { return std::set<std::uint32_t>(keys.begin(), keys.end()); },
+      [&](std::set<std::uint32_t>& set) {
+        for (auto x : batch) set.insert(x);
+      });
+  auto t_vec = time_inserts(
+      [&] { return sorted_keys; },
+      [&](std::vector<std::uint32_t>& sorted) {
+        for (auto x : batch) {
+          auto pos = std::upper_bound(sorted.begin(), sorted.end(), x);
+          sorted.insert(pos, x);
+        }
+      });
+  auto t_seg = time_inserts(
+      [&] { return sorted_keys; },
+      [&](std::vector<std::uint32_t>& remote) {
+        sorted_subvector<std::uint32_t> seg(remote);
+        for (auto x : batch) seg.insert(x);
+      });
+  auto t_merge = time_inserts(
+      [&] { return sorted_keys; },
+      [&](std::vector<std::uint32_t>& remote) {
+        sorted_subvector<std::uint32_t> seg(remote);
+        seg.merge(batch);
+      });
+  std::printf("inserts, n = %zu, batch = %zu:\n", n, k);
+  report_ns("  std::set::insert", t_set, k, t_set);
+  report_ns("  sorted vector upper_bound + insert", t_vec, k, t_set);
+  report_ns("  sorted_subvector::insert", t_seg, k, t_set);
+  report_ns("  sorted_subvector::merge (whole batch)", t_merge, k, t_set);
+}
+
+int main() {
+  lookups(1 << 14);  // cache-resident
+  lookups(1 << 22);  // 16 MB of keys
+  inserts(1 << 16, 1 << 14);
+  return 0;
+}
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Throughput (GB/s) of split() over View<std::string> against a
+// std::string_view::find / find_first_of loop, on CSV-like text.
+
+#include <iostream>
+#include <string>
+#include <string_view>
+//
+#include <view_wrapper/View.hpp>
+#include <view_wrapper/split.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::split;
+using view_wrapper::split_mode;
+using view_wrapper::View;
+
+int main() {
+  // ~64 MB of lines with fields of varying width
+  std::string text;
+  const std::size_t target = 64u << 20;
+  std::size_t i = 0;
+  while (text.size() < target) {
+    for (int f = 0; f < 6; f++) {
+      if (f) text += ',';
+      text.append(4 + (i * 7 + f * 13) % 40, char('a' + f));
+    }
+    text += '\n';
+    i++;
+  }
+  View<std::string> v(text);
+  const double gb = double(text.size()) / 1e9;
+
+  auto gbps = [gb](double ms) { return gb / (ms / 1e3); };
+
+  double t_find = bench::time_ms([&] {
+    std::string_view sv = text;
+    std::size_t fields = 0, bytes = 0, pos = 0;
+    while (true) {
+      std::size_t end = sv.find(',', pos);
+      if (end == std::string_view::npos) end = sv.size();
+      fields++;
+      bytes += end - pos;
+      if (end == sv.size()) break;
+      pos = end + 1;
+    }
+    bench::do_not_optimize(fields + bytes);
+  });
+  double t_split = bench::time_ms([&] {
+    std::size_t fields = 0, bytes = 0;
+    for (auto f : split(v, ",")) {
+      fields++;
+      bytes += f->size();
+    }
+    bench::do_not_optimize(fields + bytes);
+  });
+  double t_find2 = bench::time_ms([&] {
+    std::string_view sv = text;
+    std::size_t fields = 0, bytes = 0, pos = 0;
+    while (true) {
+      std::size_t end = sv.find_first_of(",\n", pos);
+      if (end == std::string_view::npos) end = sv.size();
+      fields++;
+      bytes += end - pos;
+      if (end == sv.size()) break;
+      pos = end + 1;
+    }
+    bench::do_not_optimize(fields + bytes);
+  });
+  double t_split2 = bench::time_ms([&] {
+    std::size_t fields = 0, bytes = 0;
+    for (auto f : split(v, ",\n")) {
+      fields++;
+      bytes += f->size();
+    }
+    bench::do_not_optimize(fields + bytes);
+  });
+  double t_csv = bench::time_ms([&] {
+    std::size_t fields = 0, bytes = 0;
+    for (auto f : split(v, ",\n", split_mode::csv)) {
+      fields++;
+      bytes += f->size();
+    }
+    bench::do_not_optimize(fields + bytes);
+  });
+
+  std::cout << "text size: " << text.size() << " bytes" << std::endl;
+  bench::report("string_view::find(',') loop", t_find);
+  std::cout << "    " << gbps(t_find) << " GB/s" << std::endl;
+  bench::report("split(v, \",\")", t_split, t_find);
+  std::cout << "    " << gbps(t_split) << " GB/s" << std::endl;
+  bench::report("string_view::find_first_of(\",\\n\") loop", t_find2);
+  std::cout << "    " << gbps(t_find2) << " GB/s" << std::endl;
+  bench::report("split(v, \",\\n\")", t_split2, t_find2);
+  std::cout << "    " << gbps(t_split2) << " GB/s" << std::endl;
+  bench::report("split(v, \",\\n\", csv)", t_csv, t_find2);
+  std::cout << "    " << gbps(t_csv) << " GB/s" << std::endl;
+  return 0;
+}
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// StableView<std::vector<T>> (remote pointer + indices) against the
+// span-based View<std::vector<T>>:
+// - iteration cost of a full scan (index and iterator loops);
+// - hot path of a growing owner: reading a few elements after push_back,
+//   via StableView against a defensive as_copy() (allocations counted).
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <vector>
+//
+#include <view_wrapper/View.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::StableView;
+using view_wrapper::View;
+
+static std::uint64_t allocations = 0;
+
+void* operator new(std::size_t n) {
+  allocations++;
+  if (void* p = std::malloc(n ? n : 1)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+int main() {
+  const std::size_t n = 256 * 1024;  // 2 MB: cache-resident scan
+  std::vector<std::int64_t> v(n);
+  std::iota(v.begin(), v.end(), 0);
+
+  // === iteration cost ===
+  View<std::vector<std::int64_t>> span_view(v);
+  StableView<std::vector<std::int64_t>> stable(v);
+
+  auto scan_span = [&] {
+    std::int64_t sum = 0;
+    for (std::int64_t x : *span_view) sum += x;
+    bench::do_not_optimize(sum);
+  };
+  bench::time_ms(scan_span);  // warm-up (page faults of v)
+  double t_span = bench::time_ms(scan_span);
+  double t_index = bench::time_ms([&] {
+    std::int64_t sum = 0;
+    for (std::size_t i = 0; i < stable.size(); i++) sum += stable[i];
+    bench::do_not_optimize(sum);
+  });
+  double t_iter = bench::time_ms([&] {
+    std::int64_t sum = 0;
+    for (std::int64_t x : stable) sum += x;
+    bench::do_not_optimize(sum);
+  });
+  bench::report("View (span) scan", t_span);
+  bench::report("StableView operator[] scan", t_index, t_span);
+  bench::report("StableView begin/end scan", t_iter, t_span);
+
+  // === growing owner: read a window after each push_back ===
+  const std::size_t window = 64;
+  const std::size_t pushes = 200'000;
+
+  std::uint64_t a_copy = 0, a_stable = 0;
+  double t_copy = bench::time_ms(
+      [&] {
+        std::vector<std::int64_t> owner(window, 1);
+        View<std::vector<std::int64_t>> head(owner);
+        // span dangles on reallocation: defensive copy of head window
+        std::vector<std::int64_t> safe = head.as_copy();
+        std::uint64_t before = allocations;
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < pushes; i++) {
+          owner.push_back(std::int64_t(i));
+          View<std::vector<std::int64_t>> fresh(safe);
+          safe = fresh.as_copy();
+          sum += safe[i % window];
+        }
+        a_copy = allocations - before;
+        bench::do_not_optimize(sum);
+      },
+      1);
+  double t_stable = bench::time_ms(
+      [&] {
+        std::vector<std::int64_t> owner(window, 1);
+        StableView<std::vector<std::int64_t>> head(owner, 0, window);
+        std::uint64_t before = allocations;
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < pushes; i++) {
+          owner.push_back(std::int64_t(i));
+          sum += head[i % window];
+        }
+        a_stable = allocations - before;
+        bench::do_not_optimize(sum);
+      },
+      1);
+  bench::report("as_copy() per read, growing owner", t_copy);
+  bench::report("StableView, growing owner", t_stable, t_copy);
+  std::cout << "allocations: as_copy()=" << a_copy
+            << " StableView=" << a_stable
+            << " (owner growth only)" << std::endl;
+  return 0;
+}
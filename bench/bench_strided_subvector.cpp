@@ -0,0 +1,74 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Processing one field of an array of structs (and every k-th element of
+// a vector): gather into a temporary vector then process (and scatter back
+// for writes), against field_view / strided_subvector in place.
+
+#include <iostream>
+#include <numeric>
+#include <vector>
+//
+#include <view_wrapper/strided_subvector.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::field_view;
+using view_wrapper::strided_subvector;
+
+struct particle {
+  float x, y, z;
+  float mass;
+  int id;
+};
+
+int main() {
+  const std::size_t n = 4'000'000;
+  std::vector<particle> ps(n);
+  for (std::size_t i = 0; i < n; i++)
+    ps[i] = particle{1.0f, 2.0f, 3.0f, float(i % 100), int(i)};
+
+  // read: total mass
+  double t_copy_sum = bench::time_ms([&] {
+    std::vector<float> masses(n);
+    for (std::size_t i = 0; i < n; i++) masses[i] = ps[i].mass;
+    bench::do_not_optimize(
+        std::accumulate(masses.begin(), masses.end(), 0.0));
+  });
+  double t_field_sum = bench::time_ms([&] {
+    field_view<&particle::mass> masses(ps);
+    bench::do_not_optimize(
+        std::accumulate(masses.begin(), masses.end(), 0.0));
+  });
+  bench::report("sum field: gather copy + accumulate", t_copy_sum);
+  bench::report("sum field: field_view", t_field_sum, t_copy_sum);
+
+  // write: scale field
+  double t_copy_scale = bench::time_ms([&] {
+    std::vector<float> masses(n);
+    for (std::size_t i = 0; i < n; i++) masses[i] = ps[i].mass;
+    for (auto& m : masses) m *= 1.0001f;
+    for (std::size_t i = 0; i < n; i++) ps[i].mass = masses[i];
+  });
+  double t_field_scale = bench::time_ms([&] {
+    for (auto& m : field_view<&particle::mass>(ps)) m *= 1.0001f;
+  });
+  bench::report("scale field: gather + scatter", t_copy_scale);
+  bench::report("scale field: field_view", t_field_scale, t_copy_scale);
+
+  // every 4th element of a flat vector
+  std::vector<float> v(4 * n, 1.0f);
+  double t_copy_stride = bench::time_ms([&] {
+    std::vector<float> tmp(n);
+    for (std::size_t i = 0; i < n; i++) tmp[i] = v[4 * i];
+    bench::do_not_optimize(std::accumulate(tmp.begin(), tmp.end(), 0.0));
+  });
+  double t_stride = bench::time_ms([&] {
+    strided_subvector<float> every4(v, 0, n, 4);
+    bench::do_not_optimize(
+        std::accumulate(every4.begin(), every4.end(), 0.0));
+  });
+  bench::report("sum stride 4: gather copy + accumulate", t_copy_stride);
+  bench::report("sum stride 4: strided_subvector", t_stride, t_copy_stride);
+  return 0;
+}
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// string_pool + interned_string keys against std::unordered_map<std::string,
+// V>: lookup ns/op (and allocations per lookup) from std::string_view
+// queries and from pre-interned handles, and memory of each key set.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <malloc.h>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+//
+#include <view_wrapper/string_pool.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::interned_string;
+using view_wrapper::string_equal;
+using view_wrapper::string_hash;
+using view_wrapper::string_pool;
+
+// live heap bytes and allocation count (glibc malloc_usable_size, so
+// bytes include malloc's rounding, as the process really pays for them)
+static std::int64_t live_bytes = 0;
+static std::uint64_t allocations = 0;
+
+void* operator new(std::size_t n) {
+  allocations++;
+  void* p = std::malloc(n ? n : 1);
+  if (!p) throw std::bad_alloc();
+  live_bytes += std::int64_t(malloc_usable_size(p));
+  return p;
+}
+// out of line: once inlined, GCC -Wall flags free() of operator new memory
+[[gnu::noinline]] void operator delete(void* p) noexcept {
+  if (!p) return;
+  live_bytes -= std::int64_t(malloc_usable_size(p));
+  std::free(p);
+}
+void operator delete(void* p, std::size_t) noexcept { operator delete(p); }
+
+int main() {
+  const std::size_t n = 1 << 20;
+  const std::size_t q = 1 << 21;
+
+  // short keys: half fit std::string SSO (user:...), half do not
+  std::vector<std::string> keys;
+  keys.reserve(n);
+  for (std::size_t i = 0; i < n; i++) {
+    std::string id = std::to_string((i * 2654435761u) % 1000000007u);
+    keys.push_back((i % 2) ? "user:" + id : "session/profile/" + id);
+  }
+  std::mt19937 rng(1);
+  std::vector<std::string_view> queries(q);
+  for (auto& s : queries) s = keys[rng() % n];
+
+  // === memory of each key set ===
+  std::int64_t before = live_bytes;
+  std::unordered_map<std::string, int> by_string;
+  for (std::size_t i = 0; i < n; i++) by_string.emplace(keys[i], int(i));
+  const std::int64_t mem_string = live_bytes - before;
+
+  // same keys, transparent hash/equality (lookups only)
+  std::unordered_map<std::string, int, string_hash, string_equal> by_string_t(
+      by_string.begin(), by_string.end());
+
+  before = live_bytes;
+  string_pool pool;
+  std::unordered_map<interned_string, int, string_hash, string_equal>
+      by_interned;
+  for (std::size_t i = 0; i < n; i++)
+    by_interned.emplace(pool.intern(keys[i]), int(i));
+  const std::int64_t mem_interned = live_bytes - before;
+
+  std::vector<interned_string> handles(q);
+  for (std::size_t i = 0; i < q; i++) handles[i] = pool.find(queries[i]);
+
+  // === lookups (all hit) ===
+  struct result {
+    double ms;
+    std::uint64_t allocs;  // per repetition
+  };
+  auto timed = [&](auto f) {
+    std::uint64_t start = allocations;
+    double t = bench::time_ms([&] {
+      std::int64_t sum = 0;
+      for (std::size_t i = 0; i < q; i++) sum += f(i);
+      bench::do_not_optimize(sum);
+    });
+    return result{t, (allocations - start) / 5};
+  };
+  auto r_string = timed([&](std::size_t i) {
+    return by_string.find(std::string(queries[i]))->second;
+  });
+  auto r_transparent = timed(
+      [&](std::size_t i) { return by_string_t.find(queries[i])->second; });
+  auto r_view = timed(
+      [&](std::size_t i) { return by_interned.find(queries[i])->second; });
+  auto r_handle = timed(
+      [&](std::size_t i) { return by_interned.find(handles[i])->second; });
+  auto r_pool = timed(
+      [&](std::size_t i) { return int(pool.find(queries[i]).size()); });
+
+  std::printf("lookups of %zu keys (%zu queries):\n", n, q);
+  auto report = [&](const char* name, result r) {
+    std::printf("%-48s %7.1f ns/op %5.2f allocs/op  (x%.2f)\n", name,
+                r.ms * 1e6 / q, double(r.allocs) / q, r_string.ms / r.ms);
+  };
+  report("  unordered_map<string>::find(string(sv))", r_string);
+  report("  unordered_map<string>::find(sv) (transparent)", r_transparent);
+  report("  unordered_map<interned_string>::find(sv)", r_view);
+  report("  unordered_map<interned_string>::find(handle)", r_handle);
+  report("  string_pool::find(sv)", r_pool);
+
+  std::printf("memory of %zu keys:\n", n);
+  std::printf("  %-46s %7.1f MB\n", "unordered_map<string, int>",
+              mem_string / 1e6);
+  std::printf("  %-46s %7.1f MB (pool %.1f MB)\n",
+              "string_pool + unordered_map<interned_string, int>",
+              mem_interned / 1e6, pool.memory_bytes() / 1e6);
+  return 0;
+}
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Template expansion of {{key}} placeholders in a large text: copying each
+// placeholder out and back in (substr + erase + insert: two tail moves and
+// an allocation) against substring::replace (single tail move, in place).
+
+#include <iostream>
+#include <string>
+#include <string_view>
+//
+#include <view_wrapper/substring.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::substring;
+
+std::string make_page(std::size_t n) {
+  std::string page;
+  for (std::size_t i = 0; i < n; i++)
+    page += "<li>item {{name}} costs {{price}} dollars</li>\n";
+  return page;
+}
+
+std::string_view expand(std::string_view key) {
+  return (key == "{{name}}") ? std::string_view{"widget-with-long-name"}
+                             : std::string_view{"9.99"};
+}
+
+int main() {
+  const std::size_t n = 5'000;
+  const std::string base = make_page(n);
+  std::string expected;
+
+  double t_copy = bench::time_ms([&] {
+    std::string page = base;
+    std::size_t pos = 0;
+    while ((pos = page.find("{{", pos)) != std::string::npos) {
+      std::size_t end = page.find("}}", pos) + 2;
+      // copy out, expand, write back
+      std::string field = page.substr(pos, end - pos);
+      field = std::string(expand(field));
+      page.erase(pos, end - pos);
+      page.insert(pos, field);
+      pos += field.size();
+    }
+    expected = page;
+  }, 3);
+
+  std::string result;
+  double t_substring = bench::time_ms([&] {
+    std::string page = base;
+    std::size_t pos = 0;
+    while ((pos = page.find("{{", pos)) != std::string::npos) {
+      substring field(page, pos, page.find("}}", pos) + 2);
+      field.replace(0, field.size(), expand(field.as_string_view()));
+      pos += field.size();
+    }
+    result = page;
+  }, 3);
+
+  bench::report("substr + erase + insert", t_copy);
+  bench::report("substring::replace", t_substring, t_copy);
+  std::cout << "same output: " << (result == expected ? "yes" : "no")
+            << std::endl;
+  return 0;
+}
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Compares subvector bulk operations (one tail move) against
+// element-by-element loops (one tail move per element), on a segment
+// at the beginning of a large remote vector.
+
+#include <iostream>
+#include <string>
+#include <vector>
+//
+#include <view_wrapper/subvector.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::subvector;
+
+int main() {
+  const std::size_t n = 200'000;
+  const std::size_t m = 2'000;
+  std::vector<int> batch(m, 7);
+
+  std::vector<int> base(n, 1);
+  double t_loop = bench::time_ms([&] {
+    std::vector<int> remote = base;
+    subvector<int> sv(remote, 0, 10);
+    for (auto x : batch) sv.push_back(x);
+    bench::do_not_optimize(remote.data());
+  });
+  double t_append = bench::time_ms([&] {
+    std::vector<int> remote = base;
+    subvector<int> sv(remote, 0, 10);
+    sv.append_range(batch);
+    bench::do_not_optimize(remote.data());
+  });
+  bench::report("append " + std::to_string(m) + " push_back loop", t_loop);
+  bench::report("append " + std::to_string(m) + " append_range", t_append,
+                t_loop);
+
+  double t_nloop = bench::time_ms([&] {
+    std::vector<int> remote = base;
+    subvector<int> sv(remote, 0, 10);
+    for (std::size_t i = 0; i < m; i++) sv.insert(sv.begin() + 5, 3);
+    bench::do_not_optimize(remote.data());
+  });
+  double t_ninsert = bench::time_ms([&] {
+    std::vector<int> remote = base;
+    subvector<int> sv(remote, 0, 10);
+    sv.insert(sv.begin() + 5, m, 3);
+    bench::do_not_optimize(remote.data());
+  });
+  bench::report("insert n copies loop", t_nloop);
+  bench::report("insert(pos, n, value)", t_ninsert, t_nloop);
+
+  std::vector<int> mixed(n);
+  for (std::size_t i = 0; i < n; i++) mixed[i] = int(i);
+  const std::size_t seg = 20'000;
+  double t_eloop = bench::time_ms([&] {
+    std::vector<int> remote = mixed;
+    subvector<int> sv(remote, 0, seg);
+    for (auto it = sv.begin(); it != sv.end();) {
+      if (*it % 2 == 0)
+        it = sv.erase(it);
+      else
+        ++it;
+    }
+    bench::do_not_optimize(remote.data());
+  });
+  double t_erase_if = bench::time_ms([&] {
+    std::vector<int> remote = mixed;
+    subvector<int> sv(remote, 0, seg);
+    sv.erase_if([](int x) { return x % 2 == 0; });
+    bench::do_not_optimize(remote.data());
+  });
+  bench::report("erase loop (half of segment)", t_eloop);
+  bench::report("erase_if (half of segment)", t_erase_if, t_eloop);
+
+  double t_rloop = bench::time_ms([&] {
+    std::vector<int> remote = base;
+    subvector<int> sv(remote, 0, 10);
+    while (sv.size() < m) sv.push_back(0);
+    bench::do_not_optimize(remote.data());
+  });
+  double t_resize = bench::time_ms([&] {
+    std::vector<int> remote = base;
+    subvector<int> sv(remote, 0, 10);
+    sv.resize(m);
+    bench::do_not_optimize(remote.data());
+  });
+  bench::report("grow by push_back loop", t_rloop);
+  bench::report("grow by resize", t_resize, t_rloop);
+
+  return 0;
+}
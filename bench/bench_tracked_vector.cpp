@@ -0,0 +1,75 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Read-mostly loop calling size() on a subvector with O(n) dynamic bounds
+// (std::find, as vv3 in demo_subvector.cpp): std::function bounds recompute
+// on every size(), while tracked_bounds only when the generation changes.
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+//
+#include <view_wrapper/subvector.hpp>
+#include <view_wrapper/tracked_vector.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::subvector;
+using view_wrapper::tracked_vector;
+
+int main() {
+  const std::size_t n = 100'000;
+  const std::size_t reads = 2'000;
+  const std::size_t write_every = 100;
+
+  auto fBounds = [](const std::vector<int>& v) {
+    auto it1 = std::find(v.begin(), v.end(), -1);
+    return std::make_pair(std::distance(v.begin(), it1) + 1, v.size());
+  };
+
+  std::vector<int> base(n, 1);
+  base[n / 2] = -1;
+
+  // counts calls made through std::function (last repetition)
+  std::size_t func_calls = 0;
+  auto countedBounds = [&](const std::vector<int>& v) {
+    func_calls++;
+    return fBounds(v);
+  };
+
+  double t_func = bench::time_ms([&] {
+    func_calls = 0;
+    std::vector<int> v = base;
+    subvector<int> sv(v, countedBounds);
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < reads; i++) {
+      if (i % write_every == 0) v.push_back(1);
+      sum += sv.size();
+    }
+    bench::do_not_optimize(sum);
+  });
+
+  std::size_t refreshes = 0;
+  std::size_t skipped = 0;
+  double t_tracked = bench::time_ms([&] {
+    tracked_vector<int> tv(base);
+    auto sv = tv.track(fBounds);
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < reads; i++) {
+      if (i % write_every == 0) tv.push_back(1);
+      sum += sv.size();
+    }
+    bench::do_not_optimize(sum);
+    refreshes = sv.bounds().refresh_count();
+    skipped = sv.bounds().skip_count();
+  });
+
+  bench::report("size() with std::function bounds", t_func);
+  bench::report("size() with tracked_bounds", t_tracked, t_func);
+  std::cout << "std::function fBounds calls: " << func_calls << std::endl;
+  std::cout << "tracked fBounds calls: " << refreshes
+            << " (skipped refresh: " << skipped << ")" << std::endl;
+  return 0;
+}
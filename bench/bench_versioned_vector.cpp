@@ -0,0 +1,119 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Reader throughput (full scans per second) of R reader threads while one
+// writer keeps updating the vector: versioned_vector snapshots against a
+// std::shared_mutex protected std::vector (baseline).
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+//
+#include <view_wrapper/versioned_vector.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::versioned_vector;
+
+// runs readers and one writer for 'ms' milliseconds, returns reader scans
+template <typename Reader, typename Writer>
+std::uint64_t run(std::size_t readers, int ms, Reader read, Writer write) {
+  std::atomic<bool> stop{false};
+  std::atomic<std::uint64_t> scans{0};
+  std::vector<std::thread> pool;
+  for (std::size_t r = 0; r < readers; r++)
+    pool.emplace_back([&] {
+      std::uint64_t local = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        bench::do_not_optimize(read());
+        local++;
+      }
+      scans += local;
+    });
+  std::thread writer([&] {
+    std::uint64_t ver = 0;
+    while (!stop.load(std::memory_order_relaxed)) {
+      write(++ver);
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  stop = true;
+  for (auto& th : pool) th.join();
+  writer.join();
+  return scans.load();
+}
+
+int main() {
+  const std::size_t n = 1024;
+  const int ms = 300;
+  std::size_t max_threads =
+      std::max<std::size_t>(4, std::thread::hardware_concurrency());
+  std::cout << "hardware threads: " << std::thread::hardware_concurrency()
+            << std::endl;
+
+  for (std::size_t r = 1; r <= max_threads; r *= 2) {
+    std::vector<std::uint64_t> shared(n, 0);
+    std::shared_mutex m;
+    std::uint64_t s_mutex = run(
+        r, ms,
+        [&] {
+          std::shared_lock<std::shared_mutex> lock(m);
+          return std::accumulate(shared.begin(), shared.end(),
+                                 std::uint64_t(0));
+        },
+        [&](std::uint64_t ver) {
+          std::unique_lock<std::shared_mutex> lock(m);
+          shared[ver % n] = ver;
+          if (ver % 64 == 0) shared.push_back(ver);
+        });
+
+    versioned_vector<std::uint64_t> vv(std::vector<std::uint64_t>(n, 0));
+    auto write = [&](std::uint64_t ver) {
+      auto& w = vv.edit();
+      w[ver % n] = ver;
+      if (ver % 64 == 0) w.push_back(ver);
+      vv.publish();
+    };
+    std::uint64_t s_versioned = run(
+        r, ms,
+        [&] {
+          auto snap = vv.snapshot();
+          return std::accumulate(snap.begin(), snap.end(), std::uint64_t(0));
+        },
+        write);
+
+    // long-lived readers: cached snapshot, reloaded only when stale
+    std::uint64_t s_cached = run(
+        r, ms,
+        [&] {
+          thread_local versioned_vector<std::uint64_t>::snapshot_type cached;
+          const auto& snap = vv.snapshot(cached);
+          return std::accumulate(snap.begin(), snap.end(), std::uint64_t(0));
+        },
+        write);
+
+    // report as time per 1000 scans (lower is better)
+    std::string sr = std::to_string(r);
+    double t_mutex = 1000.0 * ms / double(std::max<std::uint64_t>(s_mutex, 1));
+    double t_versioned =
+        1000.0 * ms / double(std::max<std::uint64_t>(s_versioned, 1));
+    double t_cached =
+        1000.0 * ms / double(std::max<std::uint64_t>(s_cached, 1));
+    bench::report("shared_mutex: 1000 scans (" + sr + " readers)", t_mutex);
+    bench::report("versioned_vector: 1000 scans (" + sr + " readers)",
+                  t_versioned, t_mutex);
+    bench::report("  cached snapshot (" + sr + " readers)", t_cached,
+                  t_mutex);
+  }
+  return 0;
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// Growth of std::vector<View<std::string>> (no reserve), as in demo.cpp,
+// against the previous layout (std::optional<std::string_view> with
+// user-provided copy/move) and plain std::string_view.
+
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+//
+#include <view_wrapper/View.hpp>
+//
+#include "./bench.hpp"
+
+using view_wrapper::View;
+
+// previous View<std::string> layout, for comparison
+class OptionalView {
+ private:
+  std::optional<std::string_view> sv;
+
+ public:
+  explicit OptionalView(std::string& s) : sv{s} {}
+  OptionalView(const OptionalView& v) : sv{v.sv} {}
+  OptionalView(OptionalView&& v) : sv{std::move(v.sv)} {}
+  OptionalView& operator=(const OptionalView& other) {
+    if (this == &other) return *this;
+    sv = other.sv;
+    return *this;
+  }
+  OptionalView& operator=(OptionalView&& other) {
+    this->sv = std::move(other.sv);
+    return *this;
+  }
+  const std::string_view& operator*() { return *sv; }
+};
+
+template <typename V>
+double grow(std::string& s, std::size_t count) {
+  return bench::time_ms([&] {
+    std::vector<V> all;  // no reserve: measures reallocation copies
+    for (std::size_t i = 0; i < count; i++) all.emplace_back(s);
+    bench::do_not_optimize(all.data());
+  });
+}
+
+int main() {
+  const std::size_t count = 4'000'000;
+  std::string s = "Hello";
+
+  std::cout << "sizeof(View<std::string>) = " << sizeof(View<std::string>)
+            << " trivially_copyable="
+            << std::is_trivially_copyable_v<View<std::string>> << std::endl;
+  std::cout << "sizeof(optional layout) = " << sizeof(OptionalView)
+            << " trivially_copyable="
+            << std::is_trivially_copyable_v<OptionalView> << std::endl;
+
+  double t_opt = grow<OptionalView>(s, count);
+  double t_view = grow<View<std::string>>(s, count);
+  double t_sv = grow<std::string_view>(s, count);
+  bench::report("grow vector<optional layout>", t_opt);
+  bench::report("grow vector<View<std::string>>", t_view, t_opt);
+  bench::report("grow vector<std::string_view>", t_sv, t_opt);
+  return 0;
+}
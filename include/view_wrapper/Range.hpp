@@ -7,76 +7,177 @@
 // Range<> is a C++20 wrapper for safer use of range types in C++
 
 #include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 //
 #include "./subvector.hpp"
+#include "./substring.hpp"
 
 namespace view_wrapper {
 
+// as IsView: as_copy(alloc), copy_into(container) and copy_into(iterator)
 template <typename Self>
-concept IsRange = requires(Self s) {
-  { s.as_copy() };
-  { s.as_range() };
-  typename Self::value_type;
-  typename Self::range_type;
-};
+concept IsRange =
+    requires(Self s, typename Self::value_type& out,
+             typename Self::value_type::value_type* it,
+             const typename Self::value_type::allocator_type& alloc) {
+      { s.as_copy() };
+      { s.as_copy(alloc) };
+      { s.copy_into(out) };
+      { s.copy_into(it) };
+      { s.as_range() };
+      typename Self::value_type;
+      typename Self::range_type;
+    };
 
 template <typename T>
 class Range;
 
-template <typename X>
-class Range<std::vector<X>>
-    : public std::ranges::view_interface<Range<std::vector<X>>> {
+// any allocator A (e.g., std::pmr::polymorphic_allocator or arena_allocator)
+template <typename X, typename A>
+class Range<std::vector<X, A>>
+    : public std::ranges::view_interface<Range<std::vector<X, A>>> {
  private:
-  std::optional<subvector<X>> sv;
+  std::optional<subvector<X, A>> sv;
 
  public:
-  using value_type = std::vector<X>;
-  using range_type = subvector<X>;
+  using value_type = std::vector<X, A>;
+  using range_type = subvector<X, A>;
 
   // no copy (perhaps?)
   // View(const View& v) = delete;
 
-  Range(const Range& v) : sv{v.sv} {}
+  constexpr Range(const Range& v) : sv{v.sv} {}
 
   // move needed for std::movable
-  Range(Range&& v) : sv{std::move(v.sv)} {}
+  constexpr Range(Range&& v) : sv{std::move(v.sv)} {}
 
   // private:
   // explicit View(const std::string& s) : std::string_view{s} {
   // DO NOT ACCEPT 'const string&' HERE! IT MAY DANGLE!
-  explicit Range(std::vector<X>& s) : sv{s} {}
+  constexpr explicit Range(std::vector<X, A>& s) : sv{s} {}
+
+  constexpr explicit Range(subvector<X, A>& s) : sv{s} {}
+
+  constexpr auto begin() const { return sv->begin(); }
+  constexpr auto end() const { return sv->end(); }
 
-  explicit Range(subvector<X>& s) : sv{s} {}
+  constexpr subvector<X, A>& as_range() { return *sv; }
 
-  auto begin() const { return sv->begin(); }
-  auto end() const { return sv->end(); }
+  // copy uses the allocator of remote vector (e.g., same arena)
+  constexpr std::vector<X, A> as_copy() { return sv->as_copy(); }
 
-  subvector<X>& as_range() { return *sv; }
+  constexpr std::vector<X, A> as_copy(const A& alloc) {
+    return sv->as_copy(alloc);
+  }
+
+  // copy into out, reusing its capacity (memcpy for trivially copyable X)
+  void copy_into(std::vector<X, A>& out) { sv->copy_into(out); }
 
-  std::vector<X> as_copy() { return std::vector<X>(*sv); }
+  template <typename OutIt>
+  OutIt copy_into(OutIt out) { return sv->copy_into(out); }
 
   // no assign (perhaps?)
   // View<std::string>& operator=(const View<std::string>& other) = delete;
-  Range& operator=(const Range& other) {
+  constexpr Range& operator=(const Range& other) {
     if (this == &other) return *this;
     sv = other.sv;
     return *this;
   }
 
   // move needed for std::movable
-  Range& operator=(Range&& other) {
+  constexpr Range& operator=(Range&& other) {
     this->sv = std::move(other.sv);
     return *this;
   }
 
-  subvector<X>& operator*() { return *sv; }
-  subvector<X>* operator->() { return &(*sv); }
+  constexpr subvector<X, A>& operator*() { return *sv; }
+  constexpr subvector<X, A>* operator->() { return &(*sv); }
 };
 
+
+// STRING PART!
+
+// writable string range: edits through as_range() write to remote string
+template <typename CharT, typename Traits, typename A>
+class Range<std::basic_string<CharT, Traits, A>>
+    : public std::ranges::view_interface<
+          Range<std::basic_string<CharT, Traits, A>>> {
+ private:
+  std::optional<basic_substring<CharT, Traits, A>> sv;
+
+ public:
+  using value_type = std::basic_string<CharT, Traits, A>;
+  using range_type = basic_substring<CharT, Traits, A>;
+
+  constexpr Range(const Range& v) : sv{v.sv} {}
+
+  // move needed for std::movable
+  constexpr Range(Range&& v) : sv{std::move(v.sv)} {}
+
+  // DO NOT ACCEPT 'const string&' HERE! IT MAY DANGLE!
+  constexpr explicit Range(value_type& s) : sv{s} {}
+
+  constexpr explicit Range(range_type& s) : sv{s} {}
+
+  constexpr auto begin() const { return sv->begin(); }
+  constexpr auto end() const { return sv->end(); }
+
+  constexpr range_type& as_range() { return *sv; }
+
+  constexpr std::basic_string_view<CharT, Traits> as_string_view() const {
+    return sv->as_string_view();
+  }
+
+  constexpr value_type as_copy() { return sv->as_copy(); }
+
+  constexpr value_type as_copy(const A& alloc) { return sv->as_copy(alloc); }
+
+  // copy into out, reusing its capacity
+  void copy_into(value_type& out) { sv->copy_into(out); }
+
+  template <typename OutIt>
+  OutIt copy_into(OutIt out) { return sv->copy_into(out); }
+
+  constexpr Range& operator=(const Range& other) {
+    if (this == &other) return *this;
+    sv = other.sv;
+    return *this;
+  }
+
+  // move needed for std::movable
+  constexpr Range& operator=(Range&& other) {
+    this->sv = std::move(other.sv);
+    return *this;
+  }
+
+  constexpr range_type& operator*() { return *sv; }
+  constexpr range_type* operator->() { return &(*sv); }
+};
+
+}  // namespace view_wrapper
+
+// Range<> is a borrowed view (view_interface makes it a view): iterators
+// point into the remote container, so they may outlive a temporary Range
+template <typename T>
+inline constexpr bool
+    std::ranges::enable_borrowed_range<view_wrapper::Range<T>> = true;
+
+namespace view_wrapper {
+
 static_assert(IsRange<Range<std::vector<int>>>);
 static_assert(std::ranges::viewable_range<Range<std::vector<int>>>);
+static_assert(std::ranges::view<Range<std::vector<int>>>);
+static_assert(std::ranges::borrowed_range<Range<std::vector<int>>>);
+static_assert(IsRange<Range<std::string>>);
+static_assert(std::ranges::viewable_range<Range<std::string>>);
+static_assert(std::ranges::borrowed_range<Range<std::string>>);
+// pipelines store the Range itself (views::all is the identity)
+static_assert(std::same_as<std::views::all_t<Range<std::vector<int>>&>,
+                           Range<std::vector<int>>>);
 
 }  // namespace view_wrapper
 
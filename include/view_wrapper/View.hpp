@@ -7,12 +7,18 @@
 // View<> is a wrapper for safer use of view types in C++
 
 #include <concepts>
-#include <optional>
+#include <cstddef>
+#include <functional>
+#include <ranges>
 #include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
+//
+#include "./copy_into.hpp"
+#include "./instrumentation.hpp"
 
 // TODO: inherit from https://en.cppreference.com/w/cpp/ranges/view_interface
 
@@ -31,13 +37,21 @@ namespace view_wrapper {
 // std::movable and std::copiable
 // =================================================
 
+// as_copy(alloc), copy_into(container) and copy_into(output iterator)
+// materialize a view without a fresh default allocation
 template <typename Self>
-concept IsView = requires(Self s) {
-  { s.as_copy() };
-  { s.as_view() };
-  typename Self::value_type;
-  typename Self::view_type;
-};
+concept IsView =
+    requires(Self s, typename Self::value_type& out,
+             typename Self::value_type::value_type* it,
+             const typename Self::value_type::allocator_type& alloc) {
+      { s.as_copy() };
+      { s.as_copy(alloc) };
+      { s.copy_into(out) };
+      { s.copy_into(it) };
+      { s.as_view() };
+      typename Self::value_type;
+      typename Self::view_type;
+    };
 
 template <typename T>
 class View;
@@ -45,47 +59,77 @@ class View;
 template <>
 class View<std::string> {
  private:
-  std::optional<std::string_view> sv;
+  // null is encoded as a null data pointer (no std::optional flag),
+  // so View<std::string> is exactly a std::string_view
+  std::string_view sv;
 
  public:
   using value_type = std::string;
   using view_type = std::string_view;
+  using iterator = std::string_view::const_iterator;
 
   // no copy (perhaps?)
   // View(const View& v) = delete;
 
-  View(const View& v) : sv{v.sv} {}
-
-  // move needed for std::movable
-  View(View&& v) : sv{std::move(v.sv)} {}
+  // trivial copy and move (needed for std::movable and memcpy reallocation)
+  View(const View& v) = default;
+  View(View&& v) = default;
 
   // private:
   // explicit View(const std::string& s) : std::string_view{s} {
   // DO NOT ACCEPT 'const string&' HERE! IT MAY DANGLE!
-  explicit View(std::string& s) : sv{s} {}
+  constexpr explicit View(std::string& s) : sv{s} {}
+
+  constexpr explicit View(std::string_view& s) : sv{s} {}
+
+  // null views have null data pointer
+  constexpr bool has_value() const { return sv.data() != nullptr; }
+
+  constexpr const std::string_view& as_view() { return sv; }
+
+  // read-only access (e.g., for hashing and comparison)
+  constexpr std::string_view as_string_view() const { return sv; }
+
+  // borrowed range: iterators point into remote string
+  constexpr iterator begin() const { return sv.begin(); }
+  constexpr iterator end() const { return sv.end(); }
 
-  explicit View(std::string_view& s) : sv{s} {}
+  constexpr std::string as_copy() { return as_copy(std::allocator<char>()); }
 
-  const std::string_view& as_view() { return *sv; }
+  constexpr std::string as_copy(const std::allocator<char>& alloc) {
+    VIEW_WRAPPER_COUNT(as_copy, 1);
+    VIEW_WRAPPER_COUNT(bytes_copied, sv.size());
+    return std::string(sv, alloc);
+  }
 
-  std::string as_copy() { return std::string(*sv); }
+  // copy into out, reusing its capacity
+  void copy_into(std::string& out) {
+    detail::bulk_copy(sv.data(), sv.size(), out);
+  }
+
+  // copy to output iterator (e.g., raw pointer or std::back_inserter)
+  template <typename OutIt>
+  OutIt copy_into(OutIt out) {
+    return detail::bulk_copy(sv.data(), sv.size(), out);
+  }
 
   // no assign (perhaps?)
   // View<std::string>& operator=(const View<std::string>& other) = delete;
-  View& operator=(const View& other) {
-    if (this == &other) return *this;
-    sv = other.sv;
-    return *this;
-  }
+  View& operator=(const View& other) = default;
 
   // move needed for std::movable
-  View& operator=(View&& other) {
-    this->sv = std::move(other.sv);
-    return *this;
-  }
+  View& operator=(View&& other) = default;
+
+  constexpr const std::string_view& operator*() { return as_view(); }
+  constexpr const std::string_view* operator->() { return &as_view(); }
 
-  const std::string_view& operator*() { return as_view(); }
-  const std::string_view* operator->() { return &as_view(); }
+  // content equality (as std::string_view), e.g., for unordered containers
+  friend constexpr bool operator==(const View& a, const View& b) {
+    return a.sv == b.sv;
+  }
+  friend constexpr bool operator==(const View& a, std::string_view b) {
+    return a.sv == b;
+  }
 };
 
 // View should support movable, otherwise it's useless in containers!
@@ -106,57 +150,208 @@ static_assert(std::copyable<View<std::string>>);
 static_assert(std::copyable<std::string_view>);
 
 static_assert(IsView<View<std::string>>);
+static_assert(sizeof(View<std::string>) == sizeof(std::string_view));
+static_assert(std::is_trivially_copyable_v<View<std::string>>);
 
 // VECTOR PART!
 
-template <typename X>
-class View<std::vector<X>> {
+// any allocator A (e.g., std::pmr::polymorphic_allocator or arena_allocator)
+template <typename X, typename A>
+class View<std::vector<X, A>> {
  private:
-  std::optional<std::span<X>> sv;
+  // null is encoded as a null data pointer (no std::optional flag)
+  std::span<X> sv;
+
+  // non-null address for views of empty vectors (which may have null data),
+  // so they are not mistaken for null views; never dereferenced
+  union empty_slot {
+    X x;
+    constexpr empty_slot() {}
+    constexpr ~empty_slot() {}
+  };
+  static inline empty_slot empty{};
 
  public:
-  using value_type = std::vector<X>;
+  using value_type = std::vector<X, A>;
   using view_type = std::span<X>;
+  using iterator = typename std::span<X>::iterator;
 
   // no copy (perhaps?)
   // View(const View& v) = delete;
 
-  View(const View& v) : sv{v.sv} {}
-
-  // move needed for std::movable
-  View(View&& v) : sv{std::move(v.sv)} {}
+  // trivial copy and move (needed for std::movable and memcpy reallocation)
+  View(const View& v) = default;
+  View(View&& v) = default;
 
   // private:
   // explicit View(const std::string& s) : std::string_view{s} {
   // DO NOT ACCEPT 'const string&' HERE! IT MAY DANGLE!
-  explicit View(std::vector<X>& s) : sv{s} {}
+  constexpr explicit View(std::vector<X, A>& s)
+      : sv{s.data() ? std::span<X>{s} : std::span<X>{&empty.x, 0}} {}
+
+  constexpr explicit View(std::span<X>& s) : sv{s} {}
 
-  explicit View(std::span<X>& s) : sv{s} {}
+  // null views have null data pointer (views of empty vectors do not)
+  constexpr bool has_value() const { return sv.data() != nullptr; }
 
-  std::span<X>& as_view() { return *sv; }
+  constexpr std::span<X>& as_view() { return sv; }
 
-  std::vector<X> as_copy() { return std::vector<X>(*sv); }
+  // borrowed range: iterators point into remote vector
+  constexpr iterator begin() const { return sv.begin(); }
+  constexpr iterator end() const { return sv.end(); }
+
+  // view does not keep remote allocator: copy uses a default-constructed A
+  constexpr std::vector<X, A> as_copy() { return as_copy(A()); }
+
+  constexpr std::vector<X, A> as_copy(const A& alloc) {
+    VIEW_WRAPPER_COUNT(as_copy, 1);
+    VIEW_WRAPPER_COUNT(bytes_copied, sv.size() * sizeof(X));
+    return std::vector<X, A>(sv.begin(), sv.end(), alloc);
+  }
+
+  // copy into out, reusing its capacity (memcpy for trivially copyable X)
+  void copy_into(std::vector<X, A>& out) {
+    detail::bulk_copy(sv.data(), sv.size(), out);
+  }
+
+  // copy to output iterator (e.g., raw pointer or std::back_inserter)
+  template <typename OutIt>
+  OutIt copy_into(OutIt out) {
+    return detail::bulk_copy(sv.data(), sv.size(), out);
+  }
 
   // no assign (perhaps?)
   // View<std::string>& operator=(const View<std::string>& other) = delete;
-  View& operator=(const View& other) {
-    if (this == &other) return *this;
-    sv = other.sv;
-    return *this;
-  }
+  View& operator=(const View& other) = default;
 
   // move needed for std::movable
-  View& operator=(View&& other) {
-    this->sv = std::move(other.sv);
-    return *this;
-  }
+  View& operator=(View&& other) = default;
 
-  const std::span<X>& operator*() { return *sv; }
-  const std::span<X>* operator->() { return &(*sv); }
+  constexpr const std::span<X>& operator*() { return sv; }
+  constexpr const std::span<X>* operator->() { return &sv; }
 };
 
 static_assert(IsView<View<std::vector<int>>>);
+static_assert(sizeof(View<std::vector<int>>) == sizeof(std::span<int>));
+static_assert(std::is_trivially_copyable_v<View<std::vector<int>>>);
+
+// =================================================
+// StableView is a read-only, reallocation-safe View:
+// as subvector, it keeps remote pointer and indices
+// (not a span), so it survives push_back on remote.
+// Element access costs one extra indirection; the
+// span-based View remains the fast path.
+// =================================================
+
+template <typename T>
+class StableView;
+
+template <typename X, typename A>
+class StableView<std::vector<X, A>> {
+ private:
+  // null is encoded as a null remote pointer
+  const std::vector<X, A>* remote{nullptr};
+  std::size_t idxBegin{0}, idxEnd{0};
+
+ public:
+  using value_type = std::vector<X, A>;
+  using view_type = std::span<const X>;
+  using size_type = std::size_t;
+  using const_iterator = const X*;
+
+  StableView(const StableView& v) = default;
+  StableView(StableView&& v) = default;
+
+  // DO NOT ACCEPT temporary vectors HERE! IT MAY DANGLE!
+  // current elements of s, in range [0, size)
+  constexpr explicit StableView(std::vector<X, A>& s)
+      : remote{&s}, idxEnd{s.size()} {}
+
+  // range [closed, open) of s
+  constexpr StableView(std::vector<X, A>& s, size_type _idxBegin,
+                       size_type _idxEnd)
+      : remote{&s}, idxBegin{_idxBegin}, idxEnd{_idxEnd} {}
+
+  constexpr bool has_value() const { return remote != nullptr; }
+
+  // span is only valid until next reallocation of remote
+  constexpr std::span<const X> as_view() const {
+    return std::span<const X>{remote->data() + idxBegin, idxEnd - idxBegin};
+  }
+
+  // copy uses the allocator of remote vector
+  constexpr std::vector<X, A> as_copy() const {
+    return as_copy(remote->get_allocator());
+  }
+
+  constexpr std::vector<X, A> as_copy(const A& alloc) const {
+    VIEW_WRAPPER_COUNT(as_copy, 1);
+    VIEW_WRAPPER_COUNT(bytes_copied, size() * sizeof(X));
+    return std::vector<X, A>(begin(), end(), alloc);
+  }
+
+  void copy_into(std::vector<X, A>& out) const {
+    detail::bulk_copy(begin(), size(), out);
+  }
+
+  template <typename OutIt>
+  OutIt copy_into(OutIt out) const {
+    return detail::bulk_copy(begin(), size(), out);
+  }
+
+  constexpr size_type size() const { return idxEnd - idxBegin; }
+  constexpr bool empty() const { return idxEnd == idxBegin; }
+
+  // O(1), through remote (valid after reallocation)
+  constexpr const X& operator[](size_type idx) const {
+    return (*remote)[idxBegin + idx];
+  }
+
+  // iterators are only valid until next reallocation of remote
+  constexpr const_iterator begin() const { return remote->data() + idxBegin; }
+  constexpr const_iterator end() const { return remote->data() + idxEnd; }
+
+  StableView& operator=(const StableView& other) = default;
+  StableView& operator=(StableView&& other) = default;
+};
+
+static_assert(IsView<StableView<std::vector<int>>>);
+static_assert(std::is_trivially_copyable_v<StableView<std::vector<int>>>);
 
 }  // namespace view_wrapper
 
+// View<> and StableView<> are borrowed views: iterators point into remote
+// data and copies are trivial, so std::views pipelines hold them by value
+// (no ref_view/owning_view), and iterators may outlive a temporary view
+template <typename T>
+inline constexpr bool
+    std::ranges::enable_borrowed_range<view_wrapper::View<T>> = true;
+template <typename T>
+inline constexpr bool std::ranges::enable_view<view_wrapper::View<T>> = true;
+template <typename T>
+inline constexpr bool
+    std::ranges::enable_borrowed_range<view_wrapper::StableView<T>> = true;
+template <typename T>
+inline constexpr bool std::ranges::enable_view<view_wrapper::StableView<T>> =
+    true;
+
+// same hash as std::string_view (and std::string) of same contents
+template <>
+struct std::hash<view_wrapper::View<std::string>> {
+  std::size_t operator()(const view_wrapper::View<std::string>& v) const {
+    return std::hash<std::string_view>{}(v.as_string_view());
+  }
+};
+
+static_assert(std::ranges::view<view_wrapper::View<std::string>>);
+static_assert(std::ranges::borrowed_range<view_wrapper::View<std::string>>);
+static_assert(std::ranges::view<view_wrapper::View<std::vector<int>>>);
+static_assert(
+    std::ranges::contiguous_range<view_wrapper::View<std::vector<int>>>);
+static_assert(
+    std::ranges::borrowed_range<view_wrapper::StableView<std::vector<int>>>);
+// pipelines store the View itself (views::all is the identity)
+static_assert(std::same_as<std::views::all_t<view_wrapper::View<std::string>>,
+                           view_wrapper::View<std::string>>);
+
 #endif  // VIEW_WRAPPER_VIEW_HPP_
@@ -0,0 +1,276 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_ARENA_HPP_
+#define VIEW_WRAPPER_ARENA_HPP_
+
+// C++14 arena allocators for std::vector<T, A> (and thus subvector<T, A>,
+// Range<std::vector<T, A>> and View<std::vector<T, A>>):
+//
+// - bump_arena: monotonic arena, allocation is a pointer bump and
+//   deallocation is a no-op; reset() releases everything at once
+//   (e.g., per request), keeping blocks for reuse.
+// - pool_arena: power-of-two size classes with free lists, so memory
+//   released by a vector is reused by the next one of similar size.
+//
+//   bump_arena arena;
+//   arena_allocator<int> alloc(arena);
+//   std::vector<int, arena_allocator<int>> v(alloc);
+//   subvector<int, arena_allocator<int>> sv(v);
+//   auto copy = sv.as_copy();  // also in arena
+//
+// Arenas are not thread-safe, and must outlive their allocations.
+// Default-constructed allocators (no arena) use the global heap.
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace view_wrapper {
+
+namespace detail {
+
+// global heap honoring over-aligned requests (C++17 aligned new)
+inline void* heap_allocate(std::size_t bytes, std::size_t align) {
+#if defined(__cpp_aligned_new)
+  if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    return ::operator new(bytes, std::align_val_t(align));
+#endif
+  (void)align;
+  return ::operator new(bytes);
+}
+
+inline void heap_deallocate(void* p, std::size_t align) noexcept {
+#if defined(__cpp_aligned_new)
+  if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    ::operator delete(p, std::align_val_t(align));
+    return;
+  }
+#endif
+  (void)align;
+  ::operator delete(p);
+}
+
+}  // namespace detail
+
+class bump_arena {
+ private:
+  struct block {
+    std::unique_ptr<unsigned char[]> data;
+    std::size_t size;
+  };
+
+  std::vector<block> blocks;
+  // current block and offset in it
+  std::size_t cur{0};
+  std::size_t offset{0};
+  std::size_t blockSize;
+  std::size_t used{0};
+
+  // aligned pointer for 'bytes' in block b at offset, or nullptr
+  static void* fit(block& b, std::size_t off, std::size_t bytes,
+                   std::size_t align, std::size_t& end) {
+    auto base = reinterpret_cast<std::uintptr_t>(b.data.get());
+    std::uintptr_t p = (base + off + align - 1) & ~(std::uintptr_t(align) - 1);
+    end = static_cast<std::size_t>(p - base) + bytes;
+    return (end <= b.size) ? reinterpret_cast<void*>(p) : nullptr;
+  }
+
+ public:
+  explicit bump_arena(std::size_t _blockSize = 64 * 1024)
+      : blockSize{_blockSize > 0 ? _blockSize : 1} {}
+
+  bump_arena(const bump_arena&) = delete;
+  bump_arena& operator=(const bump_arena&) = delete;
+
+  void* allocate(std::size_t bytes, std::size_t align) {
+    std::size_t end = 0;
+    if (cur < blocks.size()) {
+      if (void* p = fit(blocks[cur], offset, bytes, align, end)) {
+        offset = end;
+        used += bytes;
+        return p;
+      }
+      // reuse next (kept) blocks after reset()
+      while (++cur < blocks.size()) {
+        if (void* p = fit(blocks[cur], 0, bytes, align, end)) {
+          offset = end;
+          used += bytes;
+          return p;
+        }
+      }
+    }
+    // new block: geometric growth, large enough for this request
+    std::size_t size = blocks.empty() ? blockSize : 2 * blocks.back().size;
+    if (size < bytes + align) size = bytes + align;
+    blocks.push_back(block{std::unique_ptr<unsigned char[]>(
+                               new unsigned char[size]),
+                           size});
+    cur = blocks.size() - 1;
+    void* p = fit(blocks[cur], 0, bytes, align, end);
+    offset = end;
+    used += bytes;
+    return p;
+  }
+
+  // monotonic: memory is only released by reset() or destruction
+  void deallocate(void*, std::size_t, std::size_t) noexcept {}
+
+  // releases all allocations at once (blocks are kept for reuse)
+  void reset() noexcept {
+    cur = 0;
+    offset = 0;
+    used = 0;
+  }
+
+  // bytes requested since last reset()
+  std::size_t bytes_used() const { return used; }
+
+  // bytes held in blocks
+  std::size_t capacity() const {
+    std::size_t total = 0;
+    for (const auto& b : blocks) total += b.size;
+    return total;
+  }
+};
+
+class pool_arena {
+ private:
+  // size classes 2^minShift .. 2^maxShift bytes (larger use global heap)
+  static constexpr std::size_t minShift = 3;
+  static constexpr std::size_t maxShift = 16;
+  static constexpr std::size_t numClasses = maxShift - minShift + 1;
+
+  struct free_node {
+    free_node* next;
+  };
+
+  free_node* freeLists[numClasses] = {};
+  std::vector<std::unique_ptr<unsigned char[]>> slabs;
+  std::size_t slabSize;
+  std::size_t held{0};
+
+  static std::size_t class_of(std::size_t bytes) {
+    std::size_t c = 0;
+    while ((std::size_t(1) << (c + minShift)) < bytes) c++;
+    return c;
+  }
+
+  // carves a new slab into free blocks of class c
+  void refill(std::size_t c) {
+    const std::size_t size = std::size_t(1) << (c + minShift);
+    const std::size_t count = (slabSize > size) ? slabSize / size : 1;
+    slabs.emplace_back(new unsigned char[count * size]);
+    held += count * size;
+    unsigned char* base = slabs.back().get();
+    for (std::size_t i = count; i-- > 0;) {
+      auto* node = reinterpret_cast<free_node*>(base + i * size);
+      node->next = freeLists[c];
+      freeLists[c] = node;
+    }
+  }
+
+ public:
+  explicit pool_arena(std::size_t _slabSize = 64 * 1024)
+      : slabSize{_slabSize} {}
+
+  pool_arena(const pool_arena&) = delete;
+  pool_arena& operator=(const pool_arena&) = delete;
+
+  // blocks are aligned to min(size class, new[] alignment)
+  void* allocate(std::size_t bytes, std::size_t align) {
+    if (bytes > (std::size_t(1) << maxShift) ||
+        align > alignof(std::max_align_t))
+      return detail::heap_allocate(bytes, align);
+    const std::size_t c = class_of(bytes);
+    if (!freeLists[c]) refill(c);
+    free_node* node = freeLists[c];
+    freeLists[c] = node->next;
+    return node;
+  }
+
+  void deallocate(void* p, std::size_t bytes, std::size_t align) noexcept {
+    if (bytes > (std::size_t(1) << maxShift) ||
+        align > alignof(std::max_align_t)) {
+      detail::heap_deallocate(p, align);
+      return;
+    }
+    const std::size_t c = class_of(bytes);
+    auto* node = static_cast<free_node*>(p);
+    node->next = freeLists[c];
+    freeLists[c] = node;
+  }
+
+  // bytes held in slabs
+  std::size_t capacity() const { return held; }
+};
+
+// std-compatible allocator over an arena (bump_arena or pool_arena)
+template <typename T, typename Arena>
+class basic_arena_allocator {
+ private:
+  template <typename U, typename Arena2>
+  friend class basic_arena_allocator;
+
+  Arena* arena{nullptr};
+
+ public:
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = basic_arena_allocator<U, Arena>;
+  };
+
+  // no arena: global heap
+  basic_arena_allocator() noexcept = default;
+
+  explicit basic_arena_allocator(Arena& _arena) noexcept : arena{&_arena} {}
+
+  template <typename U>
+  basic_arena_allocator(const basic_arena_allocator<U, Arena>& other) noexcept
+      : arena{other.arena} {}
+
+  T* allocate(std::size_t n) {
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+      throw std::bad_array_new_length();
+    if (!arena)
+      return static_cast<T*>(detail::heap_allocate(n * sizeof(T), alignof(T)));
+    return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    if (!arena)
+      detail::heap_deallocate(p, alignof(T));
+    else
+      arena->deallocate(p, n * sizeof(T), alignof(T));
+  }
+
+  Arena* resource() const noexcept { return arena; }
+
+  template <typename U>
+  bool operator==(
+      const basic_arena_allocator<U, Arena>& other) const noexcept {
+    return arena == other.arena;
+  }
+
+  template <typename U>
+  bool operator!=(
+      const basic_arena_allocator<U, Arena>& other) const noexcept {
+    return arena != other.arena;
+  }
+};
+
+template <typename T>
+using arena_allocator = basic_arena_allocator<T, bump_arena>;
+
+template <typename T>
+using pool_allocator = basic_arena_allocator<T, pool_arena>;
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_ARENA_HPP_
@@ -0,0 +1,229 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_CHUNKED_READER_HPP_
+#define VIEW_WRAPPER_CHUNKED_READER_HPP_
+
+// chunked_reader streams inputs larger than memory as a sequence of
+// View<std::string> windows, each one holding only complete records
+// (ending in a delimiter, '\n' by default):
+//
+//   chunked_reader reader("huge.csv", 1 << 20);
+//   for (auto window : reader)
+//     for (auto line : split(window, "\n")) ...
+//
+// Chunks are read into a reusable double buffer: a record straddling a
+// chunk boundary is stitched by copying only its partial tail to the
+// start of the other buffer (never the whole chunk). A record larger
+// than a chunk grows the buffers. Optionally, the next chunk is read on a
+// background thread while the current window is processed (prefetch).
+//
+// Each window is valid until the next call to next() (or ++iterator).
+// Peak memory is about 2 * (chunk_size + longest record).
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+//
+#include "./View.hpp"
+
+namespace view_wrapper {
+
+class chunked_reader {
+ private:
+  std::unique_ptr<std::istream> owned;
+  std::istream* in{nullptr};
+  std::size_t chunkSize;
+  char delim;
+  bool prefetch;
+  // double buffer: window lives in buf[cur], carry is copied to the other
+  std::array<std::string, 2> buf;
+  int cur{1};
+  // partial record at start of buf[1 - cur]
+  std::size_t carry{0};
+  std::string_view window;
+  bool started{false};
+  bool exhausted{false};
+  bool finished{false};
+  // background read into buf[1 - cur] (after carry)
+  std::future<std::size_t> pending;
+
+  // ensures room for one chunk at buf[b][offset] (consumer thread only)
+  void reserve(int b, std::size_t offset) {
+    if (buf[b].size() < offset + chunkSize) buf[b].resize(offset + chunkSize);
+  }
+
+  std::size_t read_at(int b, std::size_t offset) {
+    in->read(buf[b].data() + offset, static_cast<std::streamsize>(chunkSize));
+    return static_cast<std::size_t>(in->gcount());
+  }
+
+ public:
+  using value_type = std::string;
+  using view_type = std::string_view;
+
+  // streams from 'path' (throws std::system_error if it cannot be opened)
+  explicit chunked_reader(const std::string& path,
+                          std::size_t _chunkSize = 1 << 20, char _delim = '\n',
+                          bool _prefetch = false)
+      : owned{std::make_unique<std::ifstream>(path, std::ios::binary)},
+        in{owned.get()},
+        chunkSize{_chunkSize > 0 ? _chunkSize : 1},
+        delim{_delim},
+        prefetch{_prefetch} {
+    if (!*in)
+      throw std::system_error(std::make_error_code(std::errc::io_error),
+                              "chunked_reader: cannot open '" + path + "'");
+  }
+
+  // streams from 'source' (must outlive the reader)
+  explicit chunked_reader(std::istream& source,
+                          std::size_t _chunkSize = 1 << 20, char _delim = '\n',
+                          bool _prefetch = false)
+      : in{&source},
+        chunkSize{_chunkSize > 0 ? _chunkSize : 1},
+        delim{_delim},
+        prefetch{_prefetch} {}
+
+  chunked_reader(const chunked_reader&) = delete;
+  chunked_reader& operator=(const chunked_reader&) = delete;
+
+  ~chunked_reader() {
+    if (pending.valid()) pending.wait();
+  }
+
+  // advances to next window (false when input is over)
+  bool next() {
+    started = true;
+    if (exhausted) {
+      finished = true;
+      window = std::string_view{};
+      return false;
+    }
+    const int b = 1 - cur;
+    std::size_t n = 0;
+    if (pending.valid()) {
+      n = pending.get();
+    } else {
+      reserve(b, carry);
+      n = read_at(b, carry);
+    }
+    std::size_t len = carry + n;
+    bool atEnd = n < chunkSize;
+    // carry has no delimiter: search only new data, from the end
+    std::size_t last = std::string_view{buf[b].data() + carry, n}.rfind(delim);
+    if (last != std::string_view::npos) last += carry;
+    // record larger than a chunk: keep reading into the same buffer
+    while (!atEnd && last == std::string_view::npos) {
+      reserve(b, len);
+      n = read_at(b, len);
+      std::size_t found = std::string_view{buf[b].data() + len, n}.rfind(delim);
+      if (found != std::string_view::npos) last = len + found;
+      len += n;
+      atEnd = n < chunkSize;
+    }
+    const std::size_t end =
+        (atEnd || last == std::string_view::npos) ? len : last + 1;
+    window = std::string_view{buf[b].data(), end};
+    cur = b;
+    // stitch: copy partial tail record to start of the other buffer
+    carry = len - end;
+    const int other = 1 - b;
+    reserve(other, carry);
+    if (carry > 0) std::memcpy(buf[other].data(), buf[b].data() + end, carry);
+    if (atEnd) {
+      exhausted = true;
+    } else if (prefetch) {
+      const std::size_t offset = carry;
+      pending = std::async(std::launch::async, [this, other, offset] {
+        return read_at(other, offset);
+      });
+    }
+    if (end == 0 && atEnd) {
+      finished = true;
+      return false;
+    }
+    return true;
+  }
+
+  // true when every window was consumed
+  bool done() const { return finished; }
+
+  // current window (complete records only)
+  const std::string_view& as_view() { return window; }
+
+  std::string as_copy() { return std::string(window); }
+
+  std::string as_copy(const std::allocator<char>& alloc) {
+    return std::string(window, alloc);
+  }
+
+  // copy of current window, reusing capacity of out
+  void copy_into(std::string& out) {
+    detail::bulk_copy(window.data(), window.size(), out);
+  }
+
+  template <typename OutIt>
+  OutIt copy_into(OutIt out) {
+    return detail::bulk_copy(window.data(), window.size(), out);
+  }
+
+  const std::string_view& operator*() { return as_view(); }
+  const std::string_view* operator->() { return &as_view(); }
+
+  // bytes held by the double buffer
+  std::size_t buffer_capacity() const {
+    return buf[0].capacity() + buf[1].capacity();
+  }
+
+  // single-pass input range of View<std::string> windows
+  class iterator {
+   private:
+    chunked_reader* reader{nullptr};
+
+   public:
+    using value_type = View<std::string>;
+    using difference_type = std::ptrdiff_t;
+    using iterator_concept = std::input_iterator_tag;
+
+    iterator() = default;
+    explicit iterator(chunked_reader* _reader) : reader{_reader} {}
+
+    View<std::string> operator*() const {
+      std::string_view w = reader->window;
+      return View<std::string>(w);
+    }
+
+    iterator& operator++() {
+      reader->next();
+      return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    bool operator==(std::default_sentinel_t) const { return reader->finished; }
+  };
+
+  // starts reading on first call (single pass)
+  iterator begin() {
+    if (!started) next();
+    return iterator(this);
+  }
+
+  std::default_sentinel_t end() const { return std::default_sentinel; }
+};
+
+static_assert(IsView<chunked_reader>);
+static_assert(std::input_iterator<chunked_reader::iterator>);
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_CHUNKED_READER_HPP_
@@ -0,0 +1,223 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_CONCURRENT_SEGMENTED_VECTOR_HPP_
+#define VIEW_WRAPPER_CONCURRENT_SEGMENTED_VECTOR_HPP_
+
+// concurrent_segmented_vector is a C++14 preallocated vector for lock-free
+// multi-producer appends: each producer thread gets an appender handle,
+// which claims block_size elements at a time with an atomic fetch_add,
+// and appends inside its own block with no locks (and no data shifts,
+// unlike subvector::emplace_back on a shared vector).
+//
+//   concurrent_segmented_vector<int> out(1 << 20, 4096);
+//   // in each thread:
+//   auto app = out.appender();
+//   app.push_back(x);
+//   // after all appenders are destroyed (e.g., threads joined):
+//   std::vector<int> dense = out.compact();
+//
+// Appender handles must be used by a single thread, and flush their block
+// size on destruction. ranges(), size() and compact() must only be called
+// when no appender is alive.
+//
+// Elements are value-initialized T on construction (T must be default
+// constructible), and appends assign into them.
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+//
+#include "./subvector.hpp"
+
+#if defined(__cpp_lib_span) && (__cpp_lib_span >= 202002L)
+#include <span>
+#endif
+
+namespace view_wrapper {
+
+template <typename T, typename A = std::allocator<T>>
+class concurrent_segmented_vector {
+ public:
+  using value_type = T;
+  using allocator_type = A;
+  using size_type = typename std::vector<T, A>::size_type;
+  using block_type = subvector<T, A, fixed_bounds>;
+
+ private:
+  std::vector<T, A> remote;
+  size_type blockSize;
+  size_type numBlocks;
+  // next block to claim (may go past numBlocks when exhausted)
+  std::atomic<size_type> nextBlock{0};
+  // filled size of each block (written once, by its appender)
+  std::vector<size_type> filled;
+
+  // claims a block index, or numBlocks when exhausted
+  size_type claim() {
+    size_type b = nextBlock.fetch_add(1, std::memory_order_relaxed);
+    return (b < numBlocks) ? b : numBlocks;
+  }
+
+  size_type block_begin(size_type b) const { return b * blockSize; }
+  size_type block_end(size_type b) const {
+    return std::min(remote.size(), (b + 1) * blockSize);
+  }
+
+ public:
+  // lock-free append handle over one claimed block at a time
+  class append_handle {
+   private:
+    concurrent_segmented_vector* owner{nullptr};
+    size_type blk{0};
+    size_type pos{0};
+    size_type end{0};
+
+    void flush() {
+      if (owner && blk < owner->numBlocks)
+        owner->filled[blk] = pos - owner->block_begin(blk);
+    }
+
+    bool next_block() {
+      flush();
+      blk = owner->claim();
+      if (blk == owner->numBlocks) {
+        pos = end = 0;
+        return false;
+      }
+      pos = owner->block_begin(blk);
+      end = owner->block_end(blk);
+      return true;
+    }
+
+   public:
+    explicit append_handle(concurrent_segmented_vector* _owner)
+        : owner{_owner}, blk{_owner->numBlocks} {}
+
+    // single owner thread: movable, not copyable
+    append_handle(const append_handle&) = delete;
+    append_handle& operator=(const append_handle&) = delete;
+
+    append_handle(append_handle&& other) noexcept
+        : owner{other.owner}, blk{other.blk}, pos{other.pos}, end{other.end} {
+      other.owner = nullptr;
+    }
+
+    append_handle& operator=(append_handle&& other) noexcept {
+      if (this == &other) return *this;
+      flush();
+      owner = other.owner;
+      blk = other.blk;
+      pos = other.pos;
+      end = other.end;
+      other.owner = nullptr;
+      return *this;
+    }
+
+    ~append_handle() { flush(); }
+
+    // appends, or returns false when capacity is exhausted
+    template <typename... XArgs>
+    bool try_emplace_back(XArgs&&... args_build) {
+      if (pos == end && !next_block()) return false;
+      owner->remote[pos++] = T(std::forward<XArgs>(args_build)...);
+      return true;
+    }
+
+    // appends (throws std::length_error when capacity is exhausted)
+    template <typename... XArgs>
+    void emplace_back(XArgs&&... args_build) {
+      if (!try_emplace_back(std::forward<XArgs>(args_build)...))
+        throw std::length_error("concurrent_segmented_vector: full");
+    }
+
+    void push_back(const T& val) { emplace_back(val); }
+
+    void push_back(T&& val) { emplace_back(std::move(val)); }
+
+    bool try_push_back(const T& val) { return try_emplace_back(val); }
+
+#if defined(__cpp_lib_span) && (__cpp_lib_span >= 202002L)
+    // elements appended to current block: a span, not a subvector, since
+    // subvector insert/erase would shift storage shared with other threads
+    std::span<T> block() {
+      if (blk == owner->numBlocks) return {};
+      T* first = owner->remote.data() + owner->block_begin(blk);
+      return std::span<T>(first, pos - owner->block_begin(blk));
+    }
+#endif
+  };
+
+  // preallocates capacity elements, claimed in blocks of _blockSize
+  explicit concurrent_segmented_vector(size_type capacity,
+                                       size_type _blockSize = 4096)
+      : remote(capacity),
+        blockSize{_blockSize > 0 ? _blockSize : 1},
+        numBlocks{(capacity + blockSize - 1) / blockSize},
+        filled(numBlocks, 0) {}
+
+  concurrent_segmented_vector(const concurrent_segmented_vector&) = delete;
+  concurrent_segmented_vector& operator=(const concurrent_segmented_vector&) =
+      delete;
+
+  // new append handle (claims its first block on first append)
+  append_handle appender() { return append_handle(this); }
+
+  size_type capacity() const { return remote.size(); }
+  size_type block_size() const { return blockSize; }
+
+  // number of claimed blocks
+  size_type num_blocks() const {
+    return std::min(nextBlock.load(std::memory_order_acquire), numBlocks);
+  }
+
+  // number of appended elements (no appender alive)
+  size_type size() const {
+    size_type total = 0;
+    for (size_type b = 0; b < num_blocks(); b++) total += filled[b];
+    return total;
+  }
+
+  // offset table: [begin, end) in storage of each claimed block, in block
+  // order (no appender alive)
+  std::vector<std::pair<size_type, size_type>> ranges() const {
+    std::vector<std::pair<size_type, size_type>> out;
+    out.reserve(num_blocks());
+    for (size_type b = 0; b < num_blocks(); b++)
+      out.emplace_back(block_begin(b), block_begin(b) + filled[b]);
+    return out;
+  }
+
+  // filled part of block b (fixed-bounds subvector over storage)
+  block_type segment(size_type b) {
+    return block_type(remote, block_begin(b), block_begin(b) + filled[b]);
+  }
+
+  // dense vector of all elements in block order, moved out of storage
+  // (container is empty afterwards; no appender alive)
+  std::vector<T, A> compact() {
+    size_type dst = 0;
+    const size_type blocks = num_blocks();
+    for (size_type b = 0; b < blocks; b++) {
+      auto first = remote.begin() + block_begin(b);
+      if (dst != block_begin(b))
+        std::move(first, first + filled[b], remote.begin() + dst);
+      dst += filled[b];
+    }
+    remote.resize(dst);
+    std::vector<T, A> out = std::move(remote);
+    remote.clear();
+    numBlocks = 0;
+    filled.clear();
+    nextBlock.store(0, std::memory_order_relaxed);
+    return out;
+  }
+};
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_CONCURRENT_SEGMENTED_VECTOR_HPP_
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_COPY_INTO_HPP_
+#define VIEW_WRAPPER_COPY_INTO_HPP_
+
+// C++14 helpers for allocation-free materialization (copy_into members of
+// View, Range, subvector, ...): contiguous elements are copied into an
+// existing container (reusing its capacity) or an output iterator, with
+// a bulk memcpy for trivially copyable types.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace view_wrapper {
+
+namespace detail {
+
+template <typename T, typename A>
+void bulk_copy(const T* first, std::size_t n, std::vector<T, A>& out,
+               std::true_type) {
+  // only growth is value-initialized: same-size reuse is a plain memcpy
+  if (out.size() < n) out.resize(n);
+  if (n > 0) std::memcpy(out.data(), first, n * sizeof(T));
+  out.resize(n);
+}
+
+template <typename T, typename A>
+void bulk_copy(const T* first, std::size_t n, std::vector<T, A>& out,
+               std::false_type) {
+  out.assign(first, first + n);
+}
+
+// [first, first + n) into out (only allocates if n > out.capacity());
+// the memcpy path resizes first, so T must also be default-insertable
+template <typename T, typename A>
+void bulk_copy(const T* first, std::size_t n, std::vector<T, A>& out) {
+  using memcpy_ok =
+      std::integral_constant<bool, std::is_trivially_copyable<T>::value &&
+                                       std::is_default_constructible<T>::value>;
+  bulk_copy(first, n, out, memcpy_ok{});
+}
+
+// strings: traits copy (memcpy for char types)
+template <typename CharT, typename Traits, typename A>
+void bulk_copy(const CharT* first, std::size_t n,
+               std::basic_string<CharT, Traits, A>& out) {
+  out.assign(first, n);
+}
+
+// [first, first + n) to output iterator, returns end of output
+template <typename T, typename OutIt>
+OutIt bulk_copy(const T* first, std::size_t n, OutIt out) {
+  return std::copy_n(first, n, out);
+}
+
+template <typename T>
+T* bulk_copy(const T* first, std::size_t n, T* out, std::true_type) {
+  if (n > 0) std::memcpy(out, first, n * sizeof(T));
+  return out + n;
+}
+
+template <typename T>
+T* bulk_copy(const T* first, std::size_t n, T* out, std::false_type) {
+  return std::copy_n(first, n, out);
+}
+
+// raw pointer output: memcpy for trivially copyable types
+template <typename T>
+T* bulk_copy(const T* first, std::size_t n, T* out) {
+  return bulk_copy(first, n, out, std::is_trivially_copyable<T>{});
+}
+
+}  // namespace detail
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_COPY_INTO_HPP_
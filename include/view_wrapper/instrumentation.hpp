@@ -0,0 +1,213 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_INSTRUMENTATION_HPP_
+#define VIEW_WRAPPER_INSTRUMENTATION_HPP_
+
+// Opt-in C++14 hot-path counters for subvector, View and Range: define
+// VIEW_WRAPPER_INSTRUMENT (in every translation unit, before including any
+// view_wrapper header) to count bounds refreshes, tail shifts of
+// emplace/insert/erase/pop_back, slices and as_copy() calls:
+//
+//   view_wrapper::instrument::reset();
+//   run_workload();
+//   auto s = view_wrapper::instrument::snapshot();
+//   std::cout << s.to_json() << std::endl;
+//   // {"refresh": 120, ..., "bytes_shifted": 4096, ...}
+//
+// When VIEW_WRAPPER_INSTRUMENT is not defined, VIEW_WRAPPER_COUNT expands
+// to nothing (its arguments are not even evaluated), so instrumented code
+// is identical to uninstrumented code, and snapshot() is all zeros.
+//
+// Counters are per-thread (relaxed atomics, no contention), and are only
+// aggregated by snapshot(); counts of finished threads are kept.
+// Nothing is counted during constant evaluation (C++20 constexpr calls).
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace view_wrapper {
+
+namespace instrument {
+
+#ifdef VIEW_WRAPPER_INSTRUMENT
+constexpr bool enabled = true;
+#else
+constexpr bool enabled = false;
+#endif
+
+enum class counter : std::size_t {
+  refresh,         // subvector bounds refresh (e.g., fBounds calls)
+  slice,           // slice() calls
+  emplace,         // emplace/emplace_back/push_back calls
+  insert,          // insert calls (single and bulk)
+  erase,           // erase calls (single and range)
+  pop_back,        // pop_back calls
+  elements_moved,  // remote tail elements shifted by the calls above
+  bytes_shifted,   // elements_moved * sizeof(element)
+  as_copy,         // as_copy() calls (one allocation each)
+  bytes_copied,    // bytes copied by as_copy()
+  count_
+};
+
+constexpr std::size_t num_counters = static_cast<std::size_t>(counter::count_);
+
+inline const char* counter_name(counter c) {
+  static const char* const names[num_counters] = {
+      "refresh",
+      "slice",
+      "emplace",
+      "insert",
+      "erase",
+      "pop_back",
+      "elements_moved",
+      "bytes_shifted",
+      "as_copy",
+      "bytes_copied",
+  };
+  return names[static_cast<std::size_t>(c)];
+}
+
+// aggregated counters of all threads
+struct stats {
+  std::array<std::uint64_t, num_counters> values{};
+
+  std::uint64_t operator[](counter c) const {
+    return values[static_cast<std::size_t>(c)];
+  }
+
+  // {"refresh": 1, "slice": 0, ...}
+  std::string to_json() const {
+    std::string out = "{";
+    for (std::size_t i = 0; i < num_counters; i++) {
+      if (i > 0) out += ", ";
+      out += "\"";
+      out += counter_name(static_cast<counter>(i));
+      out += "\": ";
+      out += std::to_string(values[i]);
+    }
+    out += "}";
+    return out;
+  }
+};
+
+namespace detail {
+
+struct thread_counters;
+
+struct registry {
+  std::mutex m;
+  std::vector<thread_counters*> live;
+  // counts of finished threads
+  std::array<std::uint64_t, num_counters> retired{};
+};
+
+inline registry& get_registry() {
+  static registry r;
+  return r;
+}
+
+// counters of one thread: only written by it, read by snapshot()
+struct thread_counters {
+  std::array<std::atomic<std::uint64_t>, num_counters> values;
+
+  thread_counters() {
+    for (auto& v : values) v.store(0, std::memory_order_relaxed);
+    registry& r = get_registry();
+    std::lock_guard<std::mutex> lock(r.m);
+    r.live.push_back(this);
+  }
+
+  ~thread_counters() {
+    registry& r = get_registry();
+    std::lock_guard<std::mutex> lock(r.m);
+    for (std::size_t i = 0; i < num_counters; i++)
+      r.retired[i] += values[i].load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < r.live.size(); i++) {
+      if (r.live[i] == this) {
+        r.live[i] = r.live.back();
+        r.live.pop_back();
+        break;
+      }
+    }
+  }
+};
+
+inline thread_counters& local() {
+  thread_local thread_counters tc;
+  return tc;
+}
+
+// single writer: plain load + store (no atomic read-modify-write)
+inline void add(counter c, std::uint64_t n) {
+  auto& v = local().values[static_cast<std::size_t>(c)];
+  v.store(v.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+// one call of kind op, shifting 'moved' elements of 'elem' bytes each
+inline void add_shift(counter op, std::uint64_t moved, std::uint64_t elem) {
+  add(op, 1);
+  add(counter::elements_moved, moved);
+  add(counter::bytes_shifted, moved * elem);
+}
+
+}  // namespace detail
+
+// sums counters of all threads (live and finished)
+inline stats snapshot() {
+  detail::registry& r = detail::get_registry();
+  std::lock_guard<std::mutex> lock(r.m);
+  stats s;
+  s.values = r.retired;
+  for (auto* tc : r.live)
+    for (std::size_t i = 0; i < num_counters; i++)
+      s.values[i] += tc->values[i].load(std::memory_order_relaxed);
+  return s;
+}
+
+// zeroes counters of all threads (call when no instrumented code runs)
+inline void reset() {
+  detail::registry& r = detail::get_registry();
+  std::lock_guard<std::mutex> lock(r.m);
+  r.retired.fill(0);
+  for (auto* tc : r.live)
+    for (auto& v : tc->values) v.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace instrument
+
+}  // namespace view_wrapper
+
+#ifdef VIEW_WRAPPER_INSTRUMENT
+// counters are skipped in constant evaluation (no thread_local there)
+#if defined(__cpp_lib_is_constant_evaluated) && \
+    (__cpp_lib_is_constant_evaluated >= 201811L)
+#define VIEW_WRAPPER_AT_RUNTIME(stmt)        \
+  do {                                       \
+    if (!std::is_constant_evaluated()) stmt; \
+  } while (0)
+#else
+#define VIEW_WRAPPER_AT_RUNTIME(stmt) stmt
+#endif
+// VIEW_WRAPPER_COUNT(name, n): adds n to counter 'name'
+#define VIEW_WRAPPER_COUNT(name, n)            \
+  VIEW_WRAPPER_AT_RUNTIME(                     \
+      ::view_wrapper::instrument::detail::add( \
+          ::view_wrapper::instrument::counter::name, (n)))
+// VIEW_WRAPPER_COUNT_SHIFT(op, moved, elem): one 'op', moving elements
+#define VIEW_WRAPPER_COUNT_SHIFT(op, moved, elem)    \
+  VIEW_WRAPPER_AT_RUNTIME(                           \
+      ::view_wrapper::instrument::detail::add_shift( \
+          ::view_wrapper::instrument::counter::op, (moved), (elem)))
+#else
+#define VIEW_WRAPPER_COUNT(name, n) static_cast<void>(0)
+#define VIEW_WRAPPER_COUNT_SHIFT(op, moved, elem) static_cast<void>(0)
+#endif
+
+#endif  // VIEW_WRAPPER_INSTRUMENTATION_HPP_
@@ -0,0 +1,284 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_MAPPED_FILE_HPP_
+#define VIEW_WRAPPER_MAPPED_FILE_HPP_
+
+// mapped_file is a read-only memory-mapped file (POSIX mmap/munmap), so
+// large inputs can be viewed without reading them into a std::string:
+//
+//   mapped_file f("input.txt", access_hint::sequential);
+//   View<mapped_file> v(f);
+//   std::string_view text = *v;  // no read copy
+//   for (auto line : split(View<std::string>(text), "\n")) ...
+//
+// mapped_array<T> reinterprets the mapping as an array of trivially
+// copyable T (e.g., binary dumps), with View<mapped_array<T>> over it.
+//
+// As with View<std::string>, views do not own the mapping: the mapped_file
+// must outlive them (temporaries are not accepted).
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+//
+#include "./View.hpp"
+
+namespace view_wrapper {
+
+// madvise hints for the expected access pattern
+enum class access_hint { normal, sequential, random, willneed };
+
+class mapped_file {
+ private:
+  const char* ptr{nullptr};
+  std::size_t len{0};
+
+  static int to_advice(access_hint hint) {
+    switch (hint) {
+      case access_hint::sequential:
+        return MADV_SEQUENTIAL;
+      case access_hint::random:
+        return MADV_RANDOM;
+      case access_hint::willneed:
+        return MADV_WILLNEED;
+      default:
+        return MADV_NORMAL;
+    }
+  }
+
+  // err is errno of the failing call (close() may overwrite errno)
+  [[noreturn]] static void fail(int err, const std::string& what) {
+    throw std::system_error(err, std::generic_category(), what);
+  }
+
+ public:
+  // empty (unmapped) file
+  mapped_file() = default;
+
+  // maps whole file read-only (throws std::system_error on failure)
+  explicit mapped_file(const std::string& path,
+                       access_hint hint = access_hint::normal) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      const int err = errno;
+      fail(err, "mapped_file: cannot open '" + path + "'");
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      const int err = errno;
+      ::close(fd);
+      fail(err, "mapped_file: cannot stat '" + path + "'");
+    }
+    len = static_cast<std::size_t>(st.st_size);
+    // zero-length mappings are invalid: empty files have null data()
+    if (len > 0) {
+      void* p = ::mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (p == MAP_FAILED) {
+        const int err = errno;
+        ::close(fd);
+        len = 0;
+        fail(err, "mapped_file: cannot map '" + path + "'");
+      }
+      ptr = static_cast<const char*>(p);
+    }
+    // mapping stays valid after close
+    ::close(fd);
+    advise(hint);
+  }
+
+  // owns the mapping: movable, not copyable
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  mapped_file(mapped_file&& other) noexcept
+      : ptr{std::exchange(other.ptr, nullptr)},
+        len{std::exchange(other.len, 0)} {}
+
+  mapped_file& operator=(mapped_file&& other) noexcept {
+    if (this == &other) return *this;
+    unmap();
+    ptr = std::exchange(other.ptr, nullptr);
+    len = std::exchange(other.len, 0);
+    return *this;
+  }
+
+  ~mapped_file() { unmap(); }
+
+  void unmap() noexcept {
+    if (ptr) ::munmap(const_cast<char*>(ptr), len);
+    ptr = nullptr;
+    len = 0;
+  }
+
+  // hint for kernel readahead (ignored on empty files)
+  void advise(access_hint hint) const {
+    if (ptr) ::madvise(const_cast<char*>(ptr), len, to_advice(hint));
+  }
+
+  const char* data() const { return ptr; }
+  std::size_t size() const { return len; }
+  bool empty() const { return len == 0; }
+
+  std::string_view as_string_view() const { return std::string_view{ptr, len}; }
+};
+
+// read-only array of trivially copyable T over a mapped file
+// (trailing bytes that do not fill a whole T are ignored)
+template <typename T>
+class mapped_array {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mapped_array requires trivially copyable T");
+
+ private:
+  mapped_file file;
+
+ public:
+  using value_type = T;
+
+  mapped_array() = default;
+
+  explicit mapped_array(const std::string& path,
+                        access_hint hint = access_hint::normal)
+      : file{path, hint} {}
+
+  explicit mapped_array(mapped_file&& _file) : file{std::move(_file)} {}
+
+  void advise(access_hint hint) const { file.advise(hint); }
+
+  // mmap returns page-aligned memory, suitable for any T
+  const T* data() const { return reinterpret_cast<const T*>(file.data()); }
+  std::size_t size() const { return file.size() / sizeof(T); }
+  bool empty() const { return size() == 0; }
+
+  const T& operator[](std::size_t idx) const { return data()[idx]; }
+
+  std::span<const T> as_span() const {
+    return std::span<const T>{data(), size()};
+  }
+};
+
+template <>
+class View<mapped_file> {
+ private:
+  std::string_view sv;
+
+ public:
+  // as_copy() reads the mapping into an owned std::string
+  using value_type = std::string;
+  using view_type = std::string_view;
+  using iterator = std::string_view::const_iterator;
+
+  View(const View& v) = default;
+  View(View&& v) = default;
+
+  // DO NOT ACCEPT 'const mapped_file&' HERE! IT MAY DANGLE!
+  explicit View(mapped_file& f) : sv{f.as_string_view()} {}
+
+  // borrowed range: iterators point into the mapping
+  iterator begin() const { return sv.begin(); }
+  iterator end() const { return sv.end(); }
+
+  // empty files have null data pointer
+  bool has_value() const { return sv.data() != nullptr; }
+
+  const std::string_view& as_view() { return sv; }
+
+  std::string as_copy() { return std::string(sv); }
+
+  std::string as_copy(const std::allocator<char>& alloc) {
+    return std::string(sv, alloc);
+  }
+
+  void copy_into(std::string& out) {
+    detail::bulk_copy(sv.data(), sv.size(), out);
+  }
+
+  template <typename OutIt>
+  OutIt copy_into(OutIt out) {
+    return detail::bulk_copy(sv.data(), sv.size(), out);
+  }
+
+  View& operator=(const View& other) = default;
+  View& operator=(View&& other) = default;
+
+  const std::string_view& operator*() { return as_view(); }
+  const std::string_view* operator->() { return &as_view(); }
+};
+
+static_assert(std::movable<View<mapped_file>>);
+static_assert(std::copyable<View<mapped_file>>);
+static_assert(IsView<View<mapped_file>>);
+static_assert(std::is_trivially_copyable_v<View<mapped_file>>);
+static_assert(std::ranges::view<View<mapped_file>>);
+static_assert(std::ranges::borrowed_range<View<mapped_file>>);
+
+template <typename T>
+class View<mapped_array<T>> {
+ private:
+  std::span<const T> sv;
+
+ public:
+  // as_copy() reads the mapping into an owned std::vector
+  using value_type = std::vector<T>;
+  using view_type = std::span<const T>;
+  using iterator = typename std::span<const T>::iterator;
+
+  View(const View& v) = default;
+  View(View&& v) = default;
+
+  // DO NOT ACCEPT 'const mapped_array&' HERE! IT MAY DANGLE!
+  explicit View(mapped_array<T>& a) : sv{a.as_span()} {}
+
+  // borrowed range: iterators point into the mapping
+  iterator begin() const { return sv.begin(); }
+  iterator end() const { return sv.end(); }
+
+  bool has_value() const { return sv.data() != nullptr; }
+
+  const std::span<const T>& as_view() { return sv; }
+
+  std::vector<T> as_copy() { return std::vector<T>(sv.begin(), sv.end()); }
+
+  std::vector<T> as_copy(const std::allocator<T>& alloc) {
+    return std::vector<T>(sv.begin(), sv.end(), alloc);
+  }
+
+  void copy_into(std::vector<T>& out) {
+    detail::bulk_copy(sv.data(), sv.size(), out);
+  }
+
+  template <typename OutIt>
+  OutIt copy_into(OutIt out) {
+    return detail::bulk_copy(sv.data(), sv.size(), out);
+  }
+
+  View& operator=(const View& other) = default;
+  View& operator=(View&& other) = default;
+
+  const std::span<const T>& operator*() { return sv; }
+  const std::span<const T>* operator->() { return &sv; }
+};
+
+static_assert(IsView<View<mapped_array<int>>>);
+static_assert(std::is_trivially_copyable_v<View<mapped_array<int>>>);
+static_assert(std::ranges::view<View<mapped_array<int>>>);
+static_assert(std::ranges::contiguous_range<View<mapped_array<int>>>);
+static_assert(std::ranges::borrowed_range<View<mapped_array<int>>>);
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_MAPPED_FILE_HPP_
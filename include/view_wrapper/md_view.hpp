@@ -0,0 +1,299 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_MD_VIEW_HPP_
+#define VIEW_WRAPPER_MD_VIEW_HPP_
+
+// md_view<T, Rank> is a C++20 multidimensional strided view (mdspan-style)
+// over flat contiguous storage (std::vector, View<std::vector<T>>,
+// subvector or std::span), with row-major, column-major or custom strides:
+//
+//   std::vector<float> img(h * w);
+//   md_view<float, 2> m(img, {h, w});
+//   m(i, j) = 1.0f;
+//   auto r = m.row(i);                 // md_view<float, 1>, zero-copy
+//   auto c = m.col(j);                 // md_view<float, 1>, stride w
+//   auto b = m.submatrix(0, 0, 8, 8);  // md_view<float, 2>, zero-copy
+//   m.for_each_tiled(32, 32, [](auto i, auto j, float& x) { ... });
+//
+// As View, md_view does not own data: the storage must outlive it (and
+// must not reallocate while viewed).
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+//
+#include "./View.hpp"
+#include "./subvector.hpp"
+
+namespace view_wrapper {
+
+enum class md_layout { row_major, col_major };
+
+template <typename T, std::size_t Rank>
+class md_view {
+  static_assert(Rank >= 1, "md_view requires Rank >= 1");
+
+ public:
+  using value_type = std::remove_cv_t<T>;
+  using element_type = T;
+  using size_type = std::size_t;
+  using index_array = std::array<size_type, Rank>;
+
+ private:
+  T* ptr{nullptr};
+  index_array ext{};
+  index_array str{};
+
+  static index_array make_strides(const index_array& e, md_layout layout) {
+    index_array s{};
+    size_type acc = 1;
+    if (layout == md_layout::row_major) {
+      for (size_type d = Rank; d-- > 0;) {
+        s[d] = acc;
+        acc *= e[d];
+      }
+    } else {
+      for (size_type d = 0; d < Rank; d++) {
+        s[d] = acc;
+        acc *= e[d];
+      }
+    }
+    return s;
+  }
+
+ public:
+  md_view() = default;
+
+  // custom layout: element (i0, i1, ...) is at ptr[i0 * s0 + i1 * s1 + ...]
+  md_view(T* _ptr, const index_array& _extents, const index_array& _strides)
+      : ptr{_ptr}, ext{_extents}, str{_strides} {}
+
+  md_view(T* _ptr, const index_array& _extents,
+          md_layout layout = md_layout::row_major)
+      : md_view(_ptr, _extents, make_strides(_extents, layout)) {}
+
+  md_view(std::span<T> data, const index_array& _extents,
+          md_layout layout = md_layout::row_major)
+      : md_view(data.data(), _extents, layout) {}
+
+  // DO NOT ACCEPT temporary vectors HERE! IT MAY DANGLE!
+  template <typename A>
+  md_view(std::vector<value_type, A>& v, const index_array& _extents,
+          md_layout layout = md_layout::row_major)
+      : md_view(v.data(), _extents, layout) {}
+
+  template <typename A>
+  md_view(View<std::vector<value_type, A>> v, const index_array& _extents,
+          md_layout layout = md_layout::row_major)
+      : md_view(v.as_view().data(), _extents, layout) {}
+
+  template <typename A, typename B>
+  md_view(subvector<value_type, A, B>& sv, const index_array& _extents,
+          md_layout layout = md_layout::row_major)
+      : md_view(sv.as_span().data(), _extents, layout) {}
+
+  static constexpr size_type rank() { return Rank; }
+  size_type extent(size_type d) const { return ext[d]; }
+  size_type stride(size_type d) const { return str[d]; }
+  const index_array& extents() const { return ext; }
+  const index_array& strides() const { return str; }
+  T* data() const { return ptr; }
+
+  // number of elements
+  size_type size() const {
+    size_type n = 1;
+    for (size_type d = 0; d < Rank; d++) n *= ext[d];
+    return n;
+  }
+  bool empty() const { return size() == 0; }
+
+  template <typename... Idx>
+    requires(sizeof...(Idx) == Rank)
+  T& operator()(Idx... idx) const {
+    const size_type ids[Rank] = {static_cast<size_type>(idx)...};
+    size_type off = 0;
+    for (size_type d = 0; d < Rank; d++) off += ids[d] * str[d];
+    return ptr[off];
+  }
+
+  // true for compact row-major storage (as_span() is then allowed)
+  bool is_contiguous() const {
+    return str == make_strides(ext, md_layout::row_major);
+  }
+
+  // contiguous storage as a flat span (throws std::logic_error otherwise)
+  std::span<T> as_span() const {
+    if (!is_contiguous())
+      throw std::logic_error("md_view::as_span: not contiguous row-major");
+    return std::span<T>{ptr, size()};
+  }
+
+  // zero-copy sub-view [offsets, offsets + sizes) in every dimension
+  md_view subview(const index_array& offsets,
+                  const index_array& sizes) const {
+    size_type off = 0;
+    for (size_type d = 0; d < Rank; d++) off += offsets[d] * str[d];
+    return md_view(ptr + off, sizes, str);
+  }
+
+  // === rank 2 helpers ===
+
+  md_view<T, 1> row(size_type i) const
+    requires(Rank == 2)
+  {
+    return md_view<T, 1>(ptr + i * str[0], {ext[1]}, {str[1]});
+  }
+
+  md_view<T, 1> col(size_type j) const
+    requires(Rank == 2)
+  {
+    return md_view<T, 1>(ptr + j * str[1], {ext[0]}, {str[0]});
+  }
+
+  md_view submatrix(size_type r0, size_type c0, size_type rows,
+                    size_type cols) const
+    requires(Rank == 2)
+  {
+    return subview({r0, c0}, {rows, cols});
+  }
+
+  // transposed view (no copy: swaps extents and strides)
+  md_view transposed() const
+    requires(Rank == 2)
+  {
+    return md_view(ptr, {ext[1], ext[0]}, {str[1], str[0]});
+  }
+
+  // f(tile) for each tile_rows x tile_cols submatrix (border tiles are
+  // smaller), tiles in row-major order
+  template <typename F>
+  void for_each_tile(size_type tile_rows, size_type tile_cols, F f) const
+    requires(Rank == 2)
+  {
+    tile_rows = std::max<size_type>(tile_rows, 1);
+    tile_cols = std::max<size_type>(tile_cols, 1);
+    for (size_type r = 0; r < ext[0]; r += tile_rows)
+      for (size_type c = 0; c < ext[1]; c += tile_cols)
+        f(submatrix(r, c, std::min(tile_rows, ext[0] - r),
+                    std::min(tile_cols, ext[1] - c)));
+  }
+
+  // f(i, j, x) for every element, visiting tiles in row-major order
+  // (cache-friendly for any layout, given tiles that fit in cache)
+  template <typename F>
+  void for_each_tiled(size_type tile_rows, size_type tile_cols, F f) const
+    requires(Rank == 2)
+  {
+    tile_rows = std::max<size_type>(tile_rows, 1);
+    tile_cols = std::max<size_type>(tile_cols, 1);
+    for (size_type r = 0; r < ext[0]; r += tile_rows) {
+      const size_type rEnd = std::min(r + tile_rows, ext[0]);
+      for (size_type c = 0; c < ext[1]; c += tile_cols) {
+        const size_type cEnd = std::min(c + tile_cols, ext[1]);
+        for (size_type i = r; i < rEnd; i++)
+          for (size_type j = c; j < cEnd; j++) f(i, j, (*this)(i, j));
+      }
+    }
+  }
+
+  // === rank 1: strided random-access range ===
+
+  // base pointer plus index: end() (and strided col(j) positions past
+  // the storage) are never formed as pointers
+  class iterator {
+   private:
+    T* base{nullptr};
+    std::ptrdiff_t step{1};
+    std::ptrdiff_t idx{0};
+
+   public:
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using iterator_concept = std::random_access_iterator_tag;
+
+    iterator() = default;
+    iterator(T* _base, std::ptrdiff_t _step, std::ptrdiff_t _idx)
+        : base{_base}, step{_step}, idx{_idx} {}
+
+    T& operator*() const { return base[idx * step]; }
+    T& operator[](difference_type n) const { return base[(idx + n) * step]; }
+
+    iterator& operator++() {
+      ++idx;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator it = *this;
+      ++idx;
+      return it;
+    }
+    iterator& operator--() {
+      --idx;
+      return *this;
+    }
+    iterator operator--(int) {
+      iterator it = *this;
+      --idx;
+      return it;
+    }
+    iterator& operator+=(difference_type n) {
+      idx += n;
+      return *this;
+    }
+    iterator& operator-=(difference_type n) {
+      idx -= n;
+      return *this;
+    }
+    friend iterator operator+(iterator it, difference_type n) {
+      return it += n;
+    }
+    friend iterator operator+(difference_type n, iterator it) {
+      return it += n;
+    }
+    friend iterator operator-(iterator it, difference_type n) {
+      return it -= n;
+    }
+    friend difference_type operator-(const iterator& a, const iterator& b) {
+      return a.idx - b.idx;
+    }
+    friend bool operator==(const iterator& a, const iterator& b) {
+      return a.idx == b.idx;
+    }
+    friend auto operator<=>(const iterator& a, const iterator& b) {
+      return a.idx <=> b.idx;
+    }
+  };
+
+  iterator begin() const
+    requires(Rank == 1)
+  {
+    return iterator(ptr, static_cast<std::ptrdiff_t>(str[0]), 0);
+  }
+
+  iterator end() const
+    requires(Rank == 1)
+  {
+    return iterator(ptr, static_cast<std::ptrdiff_t>(str[0]),
+                    static_cast<std::ptrdiff_t>(ext[0]));
+  }
+
+  T& operator[](size_type i) const
+    requires(Rank == 1)
+  {
+    return ptr[i * str[0]];
+  }
+};
+
+static_assert(std::random_access_iterator<md_view<float, 1>::iterator>);
+static_assert(std::ranges::random_access_range<md_view<float, 1>>);
+static_assert(std::is_trivially_copyable_v<md_view<float, 2>>);
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_MD_VIEW_HPP_
@@ -0,0 +1,299 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_PARALLEL_HPP_
+#define VIEW_WRAPPER_PARALLEL_HPP_
+
+// Parallel algorithms over subvector (and Range<std::vector<X>>):
+//   parallel_for_each, parallel_transform, parallel_reduce, parallel_sort
+//
+// Work is recursively split in halves with subvector::slice(a, b) until
+// it is smaller than a grain size, and runs on a small work-stealing
+// thread_pool (std::thread only): each worker owns a deque, pops its own
+// tasks LIFO and steals other workers' tasks FIFO. A thread waiting for
+// a forked half keeps running pending tasks, so nested forks never block.
+//
+// Exceptions thrown by user functions are rethrown on the calling thread.
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+//
+#include "./subvector.hpp"
+
+namespace view_wrapper {
+
+class thread_pool {
+ private:
+  using task = std::function<void()>;
+
+  struct worker_queue {
+    std::mutex mutex;
+    std::deque<task> tasks;
+  };
+
+  // one queue per worker, plus one (last) for external threads
+  std::vector<std::unique_ptr<worker_queue>> queues;
+  std::vector<std::thread> workers;
+  std::atomic<std::size_t> queued{0};
+  std::atomic<bool> stop{false};
+  std::mutex sleepMutex;
+  std::condition_variable sleepCv;
+
+  // index of current worker in its own pool (or external queue)
+  std::size_t self() const {
+    return (current_pool() == this) ? current_index() : queues.size() - 1;
+  }
+
+  static const thread_pool*& current_pool() {
+    static thread_local const thread_pool* pool = nullptr;
+    return pool;
+  }
+
+  static std::size_t& current_index() {
+    static thread_local std::size_t index = 0;
+    return index;
+  }
+
+  bool pop(std::size_t idx, task& t, bool own) {
+    worker_queue& q = *queues[idx];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (q.tasks.empty()) return false;
+    if (own) {
+      t = std::move(q.tasks.back());
+      q.tasks.pop_back();
+    } else {
+      t = std::move(q.tasks.front());
+      q.tasks.pop_front();
+    }
+    queued--;
+    return true;
+  }
+
+  void work(std::size_t idx) {
+    current_pool() = this;
+    current_index() = idx;
+    while (!stop) {
+      if (try_run_one()) continue;
+      std::unique_lock<std::mutex> lock(sleepMutex);
+      sleepCv.wait(lock, [this] { return stop || queued > 0; });
+    }
+  }
+
+ public:
+  // pool with num_threads workers (the calling thread also helps on join)
+  explicit thread_pool(
+      std::size_t num_threads = std::thread::hardware_concurrency()) {
+    num_threads = std::max<std::size_t>(num_threads, 1);
+    for (std::size_t i = 0; i <= num_threads; i++)
+      queues.push_back(std::make_unique<worker_queue>());
+    for (std::size_t i = 0; i < num_threads; i++)
+      workers.emplace_back([this, i] { work(i); });
+  }
+
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(sleepMutex);
+      stop = true;
+    }
+    sleepCv.notify_all();
+    for (auto& w : workers) w.join();
+  }
+
+  std::size_t size() const { return workers.size(); }
+
+  // pushes task to current worker queue
+  void push(task t) {
+    worker_queue& q = *queues[self()];
+    {
+      std::lock_guard<std::mutex> lock(q.mutex);
+      q.tasks.push_back(std::move(t));
+    }
+    {
+      std::lock_guard<std::mutex> lock(sleepMutex);
+      queued++;
+    }
+    sleepCv.notify_one();
+  }
+
+  // runs one pending task (own queue first, then steals), if any
+  bool try_run_one() {
+    const std::size_t idx = self();
+    task t;
+    bool found = pop(idx, t, true);
+    for (std::size_t k = 1; !found && k < queues.size(); k++)
+      found = pop((idx + k) % queues.size(), t, false);
+    if (!found) return false;
+    t();
+    return true;
+  }
+
+  // runs left() and right() in parallel, returns when both finished
+  template <typename F1, typename F2>
+  void invoke(F1&& left, F2&& right) {
+    std::atomic<bool> done{false};
+    std::exception_ptr error;
+    push([&] {
+      try {
+        right();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      done.store(true, std::memory_order_release);
+    });
+    std::exception_ptr leftError;
+    try {
+      left();
+    } catch (...) {
+      leftError = std::current_exception();
+    }
+    // right() refers to this stack frame: always wait for it
+    while (!done.load(std::memory_order_acquire))
+      if (!try_run_one()) std::this_thread::yield();
+    if (leftError) std::rethrow_exception(leftError);
+    if (error) std::rethrow_exception(error);
+  }
+};
+
+// shared pool, with one worker per hardware thread
+inline thread_pool& default_pool() {
+  static thread_pool pool;
+  return pool;
+}
+
+// default number of elements processed sequentially by a task
+constexpr std::size_t default_grain = 4096;
+
+namespace detail {
+
+// fixed-bounds subvector over whole range (subvector or Range<>)
+template <typename R>
+auto as_slice(R&& r) {
+  if constexpr (requires { r.as_range(); }) {
+    auto& sv = r.as_range();
+    return sv.slice(0, sv.size());
+  } else {
+    return r.slice(0, r.size());
+  }
+}
+
+template <typename S, typename F>
+void for_each_slice(thread_pool& pool, S s, F& f, std::size_t grain) {
+  const std::size_t n = s.size();
+  if (n <= grain) {
+    for (auto& x : s) f(x);
+    return;
+  }
+  pool.invoke([&] { for_each_slice(pool, s.slice(0, n / 2), f, grain); },
+              [&] { for_each_slice(pool, s.slice(n / 2, n), f, grain); });
+}
+
+template <typename S1, typename S2, typename F>
+void transform_slice(thread_pool& pool, S1 in, S2 out, F& f,
+                     std::size_t grain) {
+  const std::size_t n = in.size();
+  if (n <= grain) {
+    std::transform(in.begin(), in.end(), out.begin(), f);
+    return;
+  }
+  const std::size_t m = n / 2;
+  pool.invoke(
+      [&] { transform_slice(pool, in.slice(0, m), out.slice(0, m), f, grain); },
+      [&] {
+        transform_slice(pool, in.slice(m, n), out.slice(m, n), f, grain);
+      });
+}
+
+// reduction of a non-empty slice (leaves start from their first element)
+template <typename T, typename S, typename Op>
+T reduce_slice(thread_pool& pool, S s, Op& op, std::size_t grain) {
+  const std::size_t n = s.size();
+  if (n <= grain) {
+    auto it = s.begin();
+    T acc = *it;
+    for (++it; it != s.end(); ++it) acc = op(acc, *it);
+    return acc;
+  }
+  // n > grain >= 1: both halves are non-empty
+  std::optional<T> left;
+  std::optional<T> right;
+  pool.invoke(
+      [&] {
+        left.emplace(reduce_slice<T>(pool, s.slice(0, n / 2), op, grain));
+      },
+      [&] {
+        right.emplace(reduce_slice<T>(pool, s.slice(n / 2, n), op, grain));
+      });
+  return op(*left, *right);
+}
+
+template <typename S, typename Comp>
+void sort_slice(thread_pool& pool, S s, Comp& comp, std::size_t grain) {
+  const std::size_t n = s.size();
+  if (n <= grain) {
+    std::sort(s.begin(), s.end(), comp);
+    return;
+  }
+  const std::size_t m = n / 2;
+  pool.invoke([&] { sort_slice(pool, s.slice(0, m), comp, grain); },
+              [&] { sort_slice(pool, s.slice(m, n), comp, grain); });
+  std::inplace_merge(s.begin(), s.begin() + m, s.end(), comp);
+}
+
+}  // namespace detail
+
+// f(x) for every element x (in no particular order)
+template <typename R, typename F>
+void parallel_for_each(R&& r, F f, std::size_t grain = default_grain,
+                       thread_pool& pool = default_pool()) {
+  detail::for_each_slice(pool, detail::as_slice(r), f,
+                         std::max<std::size_t>(grain, 1));
+}
+
+// out[i] = f(in[i]) (out must have at least in.size() elements)
+template <typename R1, typename R2, typename F>
+void parallel_transform(R1&& in, R2&& out, F f,
+                        std::size_t grain = default_grain,
+                        thread_pool& pool = default_pool()) {
+  auto sin = detail::as_slice(in);
+  auto sout = detail::as_slice(out).slice(0, sin.size());
+  detail::transform_slice(pool, sin, sout, f, std::max<std::size_t>(grain, 1));
+}
+
+// op must be associative: like std::reduce, init is combined exactly
+// once, as op(init, partial), and partial results as op(left, right)
+template <typename R, typename T, typename Op = std::plus<>>
+T parallel_reduce(R&& r, T init, Op op = Op{},
+                  std::size_t grain = default_grain,
+                  thread_pool& pool = default_pool()) {
+  auto s = detail::as_slice(r);
+  if (s.size() == 0) return init;
+  return op(init, detail::reduce_slice<T>(pool, s, op,
+                                          std::max<std::size_t>(grain, 1)));
+}
+
+// parallel merge sort: leaves use std::sort, halves use std::inplace_merge
+template <typename R, typename Comp = std::less<>>
+void parallel_sort(R&& r, Comp comp = Comp{},
+                   std::size_t grain = default_grain,
+                   thread_pool& pool = default_pool()) {
+  detail::sort_slice(pool, detail::as_slice(r), comp,
+                     std::max<std::size_t>(grain, 1));
+}
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_PARALLEL_HPP_
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_PARTITIONED_VECTOR_HPP_
+#define VIEW_WRAPPER_PARTITIONED_VECTOR_HPP_
+
+// partitioned_vector is a C++14 owner of a vector split into k contiguous
+// segments, handing out sibling-aware subvectors for each segment.
+//
+// Segment sizes are kept in a Fenwick tree (binary indexed tree), so an
+// insert/erase through one segment shifts the bounds of all its siblings
+// in O(log k), with no O(n) bounds scan on refresh().
+//
+// As with other dynamic bounds, siblings pick up the new bounds on size(),
+// before push/pop, or on a manual refresh().
+
+#include <memory>
+#include <utility>
+#include <vector>
+//
+#include "./subvector.hpp"
+
+namespace view_wrapper {
+
+template <typename T, typename A>
+class partitioned_vector;
+
+// bounds policy for segment 'seg' of a partitioned_vector:
+//   - refresh() reads [offset(seg), offset(seg + 1)) from the owner
+//   - grow()/shrink() report size changes back to the owner
+template <typename T, typename A = std::allocator<T>>
+class partition_bounds {
+ public:
+  using size_type = typename std::vector<T, A>::size_type;
+  using slice_policy = fixed_bounds;
+
+ private:
+  partitioned_vector<T, A>* owner{nullptr};
+  size_type seg{0};
+
+ public:
+  partition_bounds(partitioned_vector<T, A>* _owner, size_type _seg)
+      : owner{_owner}, seg{_seg} {}
+
+  static constexpr bool refresh_on_size() { return true; }
+  static constexpr bool refresh_before_push_pop() { return true; }
+
+  void refresh(const std::vector<T, A>&, size_type& idxBegin,
+               size_type& idxEnd) const {
+    idxBegin = owner->offset(seg);
+    idxEnd = owner->offset(seg + 1);
+  }
+
+  void grow(size_type n) const { owner->grow(seg, n); }
+  void shrink(size_type n) const { owner->shrink(seg, n); }
+};
+
+template <typename T, typename A = std::allocator<T>>
+class partitioned_vector {
+ public:
+  using value_type = T;
+  using allocator_type = A;
+  using size_type = typename std::vector<T, A>::size_type;
+  using segment_type = subvector<T, A, partition_bounds<T, A>>;
+
+  friend class partition_bounds<T, A>;
+
+ private:
+  std::vector<T, A> remote;
+  // Fenwick tree over segment sizes (1-based)
+  std::vector<size_type> tree;
+
+  void grow(size_type seg, size_type n) {
+    for (size_type i = seg + 1; i < tree.size(); i += i & (~i + 1))
+      tree[i] += n;
+  }
+
+  void shrink(size_type seg, size_type n) {
+    for (size_type i = seg + 1; i < tree.size(); i += i & (~i + 1))
+      tree[i] -= n;
+  }
+
+ public:
+  // k empty segments
+  explicit partitioned_vector(size_type k) : tree(k + 1, 0) {}
+
+  // segments of given sizes over existing data
+  // (sum of segment sizes must be data.size())
+  partitioned_vector(std::vector<T, A> data,
+                     const std::vector<size_type>& sizes)
+      : remote{std::move(data)}, tree(sizes.size() + 1, 0) {
+    // O(k) Fenwick construction
+    for (size_type i = 1; i < tree.size(); i++) {
+      tree[i] += sizes[i - 1];
+      size_type parent = i + (i & (~i + 1));
+      if (parent < tree.size()) tree[parent] += tree[i];
+    }
+  }
+
+  partitioned_vector(const partitioned_vector&) = delete;
+  partitioned_vector& operator=(const partitioned_vector&) = delete;
+
+  size_type num_segments() const { return tree.size() - 1; }
+
+  size_type size() const { return remote.size(); }
+
+  // first index of segment 'seg' (offset(num_segments()) == size())
+  size_type offset(size_type seg) const {
+    size_type sum = 0;
+    for (size_type i = seg; i > 0; i -= i & (~i + 1)) sum += tree[i];
+    return sum;
+  }
+
+  size_type segment_size(size_type seg) const {
+    return offset(seg + 1) - offset(seg);
+  }
+
+  // sibling-aware subvector over segment 'seg'
+  segment_type segment(size_type seg) {
+    return segment_type(remote, partition_bounds<T, A>(this, seg));
+  }
+
+  // read-only access to the whole underlying vector
+  const std::vector<T, A>& as_vector() const { return remote; }
+};
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_PARTITIONED_VECTOR_HPP_
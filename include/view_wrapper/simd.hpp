@@ -0,0 +1,681 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_SIMD_HPP_
+#define VIEW_WRAPPER_SIMD_HPP_
+
+// SIMD reduction and search algorithms over contiguous ranges:
+// View<std::vector<X>>, Range<std::vector<X>>, subvector, std::span, ...
+//
+// Kernels for int32_t and float are provided for SSE2, AVX2 and AVX-512F,
+// selected at runtime by CPU detection (no -mavx2 flag needed), with a
+// scalar fallback for other element types, compilers and architectures.
+//
+// Differences from scalar std algorithms:
+//   - integer sum wraps around (as unsigned arithmetic) instead of UB
+//   - float sum is reassociated, so it may differ by rounding
+//   - min/max require a non-empty range (as std::ranges::min/max) and
+//     assume no NaN elements
+//   - find returns the index of the first match (or size, if not found)
+//   - integer equal is std::equal (memcmp), which is already vectorized
+//
+// Byte search (find_first_of) is also provided, for text views.
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define VIEW_WRAPPER_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace view_wrapper::simd {
+
+// instruction set levels, in increasing order
+enum class isa { scalar = 0, sse2 = 1, avx2 = 2, avx512 = 3 };
+
+// best instruction set supported by this CPU (detected once)
+inline isa detect_isa() {
+#ifdef VIEW_WRAPPER_SIMD_X86
+  static const isa level = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return isa::avx512;
+    if (__builtin_cpu_supports("avx2")) return isa::avx2;
+    if (__builtin_cpu_supports("sse2")) return isa::sse2;
+    return isa::scalar;
+  }();
+  return level;
+#else
+  return isa::scalar;
+#endif
+}
+
+inline const char* isa_name(isa level) {
+  switch (level) {
+    case isa::sse2:
+      return "sse2";
+    case isa::avx2:
+      return "avx2";
+    case isa::avx512:
+      return "avx512";
+    default:
+      return "scalar";
+  }
+}
+
+namespace detail {
+
+// element types with SIMD kernels
+template <typename T>
+concept Vectorizable = std::same_as<T, std::int32_t> || std::same_as<T, float>;
+
+// contiguous (data, size) of a View (as_view()) or contiguous range
+template <typename R>
+auto as_contiguous(R&& r) {
+  if constexpr (requires { r.as_view(); }) {
+    const auto& v = r.as_view();
+    return std::span{std::ranges::data(v), std::ranges::size(v)};
+  } else {
+    // size first: it may refresh dynamic bounds (e.g., subvector)
+    auto n = std::size_t(std::ranges::size(r));
+    return std::span{std::ranges::data(r), n};
+  }
+}
+
+// ===== scalar fallback =====
+
+namespace scalar {
+
+template <typename T>
+T sum(const T* p, std::size_t n) {
+  if constexpr (std::is_integral_v<T>) {
+    std::make_unsigned_t<T> acc = 0;
+    for (std::size_t i = 0; i < n; i++) acc += std::make_unsigned_t<T>(p[i]);
+    return T(acc);
+  } else {
+    T acc{};
+    for (std::size_t i = 0; i < n; i++) acc += p[i];
+    return acc;
+  }
+}
+
+// a + b (wraps around for integers)
+template <typename T>
+T add(T a, T b) {
+  if constexpr (std::is_integral_v<T>)
+    return T(std::make_unsigned_t<T>(a) + std::make_unsigned_t<T>(b));
+  else
+    return a + b;
+}
+
+template <typename T>
+T min(const T* p, std::size_t n) {
+  return *std::min_element(p, p + n);
+}
+
+template <typename T>
+T max(const T* p, std::size_t n) {
+  return *std::max_element(p, p + n);
+}
+
+template <typename T>
+std::size_t count(const T* p, std::size_t n, T value) {
+  return std::size_t(std::count(p, p + n, value));
+}
+
+template <typename T>
+std::size_t find(const T* p, std::size_t n, T value) {
+  return std::size_t(std::find(p, p + n, value) - p);
+}
+
+template <typename T>
+bool equal(const T* a, const T* b, std::size_t n) {
+  return std::equal(a, a + n, b);
+}
+
+// index of first byte in set (or n, if not found)
+inline std::size_t find_first_of(const char* p, std::size_t n,
+                                 const char* set, std::size_t k) {
+  for (std::size_t i = 0; i < n; i++)
+    for (std::size_t j = 0; j < k; j++)
+      if (p[i] == set[j]) return i;
+  return n;
+}
+
+}  // namespace scalar
+
+#ifdef VIEW_WRAPPER_SIMD_X86
+
+// ===== SSE2 (4 lanes) =====
+
+namespace sse2 {
+
+#define VIEW_WRAPPER_TARGET __attribute__((target("sse2")))
+
+// SSE2 has no 32-bit integer min/max
+VIEW_WRAPPER_TARGET inline __m128i min_epi32(__m128i a, __m128i b) {
+  __m128i gt = _mm_cmpgt_epi32(a, b);
+  return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+}
+
+VIEW_WRAPPER_TARGET inline __m128i max_epi32(__m128i a, __m128i b) {
+  __m128i gt = _mm_cmpgt_epi32(a, b);
+  return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+}
+
+// 4-bit mask of equal lanes
+VIEW_WRAPPER_TARGET inline int eq_mask(const float* a, const float* b) {
+  return _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+}
+
+template <typename T>
+VIEW_WRAPPER_TARGET inline int eq_mask(const T* a, T value) {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(a), _mm_set1_ps(value)));
+  } else {
+    __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+    return _mm_movemask_ps(
+        _mm_castsi128_ps(_mm_cmpeq_epi32(va, _mm_set1_epi32(value))));
+  }
+}
+
+template <typename T>
+VIEW_WRAPPER_TARGET T sum(const T* p, std::size_t n) {
+  std::size_t i = 0;
+  T lanes[4];
+  if constexpr (std::is_same_v<T, float>) {
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 4 <= n; i += 4) acc = _mm_add_ps(acc, _mm_loadu_ps(p + i));
+    _mm_storeu_ps(lanes, acc);
+  } else {
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 4 <= n; i += 4)
+      acc = _mm_add_epi32(
+          acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+  }
+  T total = scalar::sum(lanes, 4);
+  T tail = scalar::sum(p + i, n - i);
+  return scalar::add(total, tail);
+}
+
+template <typename T, bool IsMin>
+VIEW_WRAPPER_TARGET T minmax(const T* p, std::size_t n) {
+  if (n < 4) return IsMin ? scalar::min(p, n) : scalar::max(p, n);
+  std::size_t i = 4;
+  T lanes[5];
+  if constexpr (std::is_same_v<T, float>) {
+    __m128 acc = _mm_loadu_ps(p);
+    for (; i + 4 <= n; i += 4)
+      acc = IsMin ? _mm_min_ps(acc, _mm_loadu_ps(p + i))
+                  : _mm_max_ps(acc, _mm_loadu_ps(p + i));
+    _mm_storeu_ps(lanes, acc);
+  } else {
+    __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    for (; i + 4 <= n; i += 4) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+      acc = IsMin ? min_epi32(acc, v) : max_epi32(acc, v);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+  }
+  lanes[4] = IsMin ? scalar::min(lanes, 4) : scalar::max(lanes, 4);
+  if (i == n) return lanes[4];
+  T tail = IsMin ? scalar::min(p + i, n - i) : scalar::max(p + i, n - i);
+  return IsMin ? std::min(lanes[4], tail) : std::max(lanes[4], tail);
+}
+
+// SSE2 has no popcnt: equal lanes are -1, so subtract them into counters
+template <typename T>
+VIEW_WRAPPER_TARGET std::size_t count(const T* p, std::size_t n, T value) {
+  std::size_t i = 0;
+  std::size_t total = 0;
+  while (i + 4 <= n) {
+    // lane counters never overflow within a block
+    const std::size_t block = std::min(n - i, std::size_t(1) << 30) / 4 * 4;
+    __m128i acc = _mm_setzero_si128();
+    for (std::size_t end = i + block; i < end; i += 4) {
+      __m128i eq;
+      if constexpr (std::is_same_v<T, float>)
+        eq = _mm_castps_si128(
+            _mm_cmpeq_ps(_mm_loadu_ps(p + i), _mm_set1_ps(value)));
+      else
+        eq = _mm_cmpeq_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)),
+            _mm_set1_epi32(value));
+      acc = _mm_sub_epi32(acc, eq);
+    }
+    std::uint32_t lanes[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    total += std::size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+  }
+  return total + scalar::count(p + i, n - i, value);
+}
+
+template <typename T>
+VIEW_WRAPPER_TARGET std::size_t find(const T* p, std::size_t n, T value) {
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    int mask = eq_mask(p + i, value);
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+  return i + scalar::find(p + i, n - i, value);
+}
+
+// (float only: integers compare bitwise, with memcmp)
+VIEW_WRAPPER_TARGET inline bool equal(const float* a, const float* b,
+                                      std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    if (eq_mask(a + i, b + i) != 0xF) return false;
+  return scalar::equal(a + i, b + i, n - i);
+}
+
+// index of first byte in set of 1 to 4 bytes (or n, if not found)
+VIEW_WRAPPER_TARGET inline std::size_t find_first_of(const char* p,
+                                                     std::size_t n,
+                                                     const char* set,
+                                                     std::size_t k) {
+  // missing set bytes repeat the last one, so 4 compares are branchless
+  const __m128i s0 = _mm_set1_epi8(set[0]);
+  const __m128i s1 = _mm_set1_epi8(set[std::min<std::size_t>(1, k - 1)]);
+  const __m128i s2 = _mm_set1_epi8(set[std::min<std::size_t>(2, k - 1)]);
+  const __m128i s3 = _mm_set1_epi8(set[std::min<std::size_t>(3, k - 1)]);
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    __m128i eq = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, s0), _mm_cmpeq_epi8(v, s1)),
+        _mm_or_si128(_mm_cmpeq_epi8(v, s2), _mm_cmpeq_epi8(v, s3)));
+    int mask = _mm_movemask_epi8(eq);
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+  return i + scalar::find_first_of(p + i, n - i, set, k);
+}
+
+#undef VIEW_WRAPPER_TARGET
+
+}  // namespace sse2
+
+// ===== AVX2 (8 lanes) =====
+
+namespace avx2 {
+
+#define VIEW_WRAPPER_TARGET __attribute__((target("avx2")))
+
+// 8-bit mask of equal lanes
+VIEW_WRAPPER_TARGET inline int eq_mask(const float* a, const float* b) {
+  return _mm256_movemask_ps(
+      _mm256_cmp_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b), _CMP_EQ_OQ));
+}
+
+template <typename T>
+VIEW_WRAPPER_TARGET inline int eq_mask(const T* a, T value) {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(
+        _mm256_loadu_ps(a), _mm256_set1_ps(value), _CMP_EQ_OQ));
+  } else {
+    __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+    return _mm256_movemask_ps(_mm256_castsi256_ps(
+        _mm256_cmpeq_epi32(va, _mm256_set1_epi32(value))));
+  }
+}
+
+template <typename T>
+VIEW_WRAPPER_TARGET T sum(const T* p, std::size_t n) {
+  std::size_t i = 0;
+  T lanes[8];
+  if constexpr (std::is_same_v<T, float>) {
+    __m256 acc = _mm256_setzero_ps();
+    for (; i + 8 <= n; i += 8)
+      acc = _mm256_add_ps(acc, _mm256_loadu_ps(p + i));
+    _mm256_storeu_ps(lanes, acc);
+  } else {
+    __m256i acc = _mm256_setzero_si256();
+    for (; i + 8 <= n; i += 8)
+      acc = _mm256_add_epi32(
+          acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+  }
+  T total = scalar::sum(lanes, 8);
+  T tail = scalar::sum(p + i, n - i);
+  return scalar::add(total, tail);
+}
+
+template <typename T, bool IsMin>
+VIEW_WRAPPER_TARGET T minmax(const T* p, std::size_t n) {
+  if (n < 8) return IsMin ? scalar::min(p, n) : scalar::max(p, n);
+  std::size_t i = 8;
+  T lanes[9];
+  if constexpr (std::is_same_v<T, float>) {
+    __m256 acc = _mm256_loadu_ps(p);
+    for (; i + 8 <= n; i += 8)
+      acc = IsMin ? _mm256_min_ps(acc, _mm256_loadu_ps(p + i))
+                  : _mm256_max_ps(acc, _mm256_loadu_ps(p + i));
+    _mm256_storeu_ps(lanes, acc);
+  } else {
+    __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    for (; i + 8 <= n; i += 8) {
+      __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+      acc = IsMin ? _mm256_min_epi32(acc, v) : _mm256_max_epi32(acc, v);
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+  }
+  lanes[8] = IsMin ? scalar::min(lanes, 8) : scalar::max(lanes, 8);
+  if (i == n) return lanes[8];
+  T tail = IsMin ? scalar::min(p + i, n - i) : scalar::max(p + i, n - i);
+  return IsMin ? std::min(lanes[8], tail) : std::max(lanes[8], tail);
+}
+
+template <typename T>
+VIEW_WRAPPER_TARGET std::size_t count(const T* p, std::size_t n, T value) {
+  std::size_t i = 0;
+  std::size_t total = 0;
+  for (; i + 8 <= n; i += 8) total += __builtin_popcount(eq_mask(p + i, value));
+  return total + scalar::count(p + i, n - i, value);
+}
+
+template <typename T>
+VIEW_WRAPPER_TARGET std::size_t find(const T* p, std::size_t n, T value) {
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    int mask = eq_mask(p + i, value);
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+  return i + scalar::find(p + i, n - i, value);
+}
+
+// (float only: integers compare bitwise, with memcmp)
+VIEW_WRAPPER_TARGET inline bool equal(const float* a, const float* b,
+                                      std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+    if (eq_mask(a + i, b + i) != 0xFF) return false;
+  return scalar::equal(a + i, b + i, n - i);
+}
+
+// index of first byte in set of 1 to 4 bytes (or n, if not found)
+VIEW_WRAPPER_TARGET inline std::size_t find_first_of(const char* p,
+                                                     std::size_t n,
+                                                     const char* set,
+                                                     std::size_t k) {
+  // missing set bytes repeat the last one, so 4 compares are branchless
+  const __m256i s0 = _mm256_set1_epi8(set[0]);
+  const __m256i s1 = _mm256_set1_epi8(set[std::min<std::size_t>(1, k - 1)]);
+  const __m256i s2 = _mm256_set1_epi8(set[std::min<std::size_t>(2, k - 1)]);
+  const __m256i s3 = _mm256_set1_epi8(set[std::min<std::size_t>(3, k - 1)]);
+  std::size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    __m256i eq = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, s0), _mm256_cmpeq_epi8(v, s1)),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, s2), _mm256_cmpeq_epi8(v, s3)));
+    unsigned mask = unsigned(_mm256_movemask_epi8(eq));
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+  return i + scalar::find_first_of(p + i, n - i, set, k);
+}
+
+#undef VIEW_WRAPPER_TARGET
+
+}  // namespace avx2
+
+// ===== AVX-512F (16 lanes) =====
+
+// GCC 12 avx512fintrin.h triggers false -Wmaybe-uninitialized (PR105593)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace avx512 {
+
+#define VIEW_WRAPPER_TARGET __attribute__((target("avx512f")))
+
+// 16-bit mask of equal lanes
+VIEW_WRAPPER_TARGET inline unsigned eq_mask(const float* a, const float* b) {
+  return _mm512_cmp_ps_mask(_mm512_loadu_ps(a), _mm512_loadu_ps(b),
+                            _CMP_EQ_OQ);
+}
+
+template <typename T>
+VIEW_WRAPPER_TARGET inline unsigned eq_mask(const T* a, T value) {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm512_cmp_ps_mask(_mm512_loadu_ps(a), _mm512_set1_ps(value),
+                              _CMP_EQ_OQ);
+  } else {
+    return _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(a),
+                                   _mm512_set1_epi32(value));
+  }
+}
+
+template <typename T>
+VIEW_WRAPPER_TARGET T sum(const T* p, std::size_t n) {
+  std::size_t i = 0;
+  T lanes[16];
+  if constexpr (std::is_same_v<T, float>) {
+    __m512 acc = _mm512_setzero_ps();
+    for (; i + 16 <= n; i += 16)
+      acc = _mm512_add_ps(acc, _mm512_loadu_ps(p + i));
+    _mm512_storeu_ps(lanes, acc);
+  } else {
+    __m512i acc = _mm512_setzero_si512();
+    for (; i + 16 <= n; i += 16)
+      acc = _mm512_add_epi32(acc, _mm512_loadu_si512(p + i));
+    _mm512_storeu_si512(lanes, acc);
+  }
+  T total = scalar::sum(lanes, 16);
+  T tail = scalar::sum(p + i, n - i);
+  return scalar::add(total, tail);
+}
+
+template <typename T, bool IsMin>
+VIEW_WRAPPER_TARGET T minmax(const T* p, std::size_t n) {
+  if (n < 16) return IsMin ? scalar::min(p, n) : scalar::max(p, n);
+  std::size_t i = 16;
+  T lanes[17];
+  if constexpr (std::is_same_v<T, float>) {
+    __m512 acc = _mm512_loadu_ps(p);
+    for (; i + 16 <= n; i += 16)
+      acc = IsMin ? _mm512_min_ps(acc, _mm512_loadu_ps(p + i))
+                  : _mm512_max_ps(acc, _mm512_loadu_ps(p + i));
+    _mm512_storeu_ps(lanes, acc);
+  } else {
+    __m512i acc = _mm512_loadu_si512(p);
+    for (; i + 16 <= n; i += 16) {
+      __m512i v = _mm512_loadu_si512(p + i);
+      acc = IsMin ? _mm512_min_epi32(acc, v) : _mm512_max_epi32(acc, v);
+    }
+    _mm512_storeu_si512(lanes, acc);
+  }
+  lanes[16] = IsMin ? scalar::min(lanes, 16) : scalar::max(lanes, 16);
+  if (i == n) return lanes[16];
+  T tail = IsMin ? scalar::min(p + i, n - i) : scalar::max(p + i, n - i);
+  return IsMin ? std::min(lanes[16], tail) : std::max(lanes[16], tail);
+}
+
+template <typename T>
+VIEW_WRAPPER_TARGET std::size_t count(const T* p, std::size_t n, T value) {
+  std::size_t i = 0;
+  std::size_t total = 0;
+  for (; i + 16 <= n; i += 16)
+    total += __builtin_popcount(eq_mask(p + i, value));
+  return total + scalar::count(p + i, n - i, value);
+}
+
+template <typename T>
+VIEW_WRAPPER_TARGET std::size_t find(const T* p, std::size_t n, T value) {
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    unsigned mask = eq_mask(p + i, value);
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+  return i + scalar::find(p + i, n - i, value);
+}
+
+// (float only: integers compare bitwise, with memcmp)
+VIEW_WRAPPER_TARGET inline bool equal(const float* a, const float* b,
+                                      std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16)
+    if (eq_mask(a + i, b + i) != 0xFFFF) return false;
+  return scalar::equal(a + i, b + i, n - i);
+}
+
+#undef VIEW_WRAPPER_TARGET
+
+}  // namespace avx512
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // VIEW_WRAPPER_SIMD_X86
+
+// requested level, limited to what this CPU supports
+inline isa clamp(isa level) { return std::min(level, detect_isa()); }
+
+}  // namespace detail
+
+// ===== public algorithms =====
+// Each one accepts an optional isa level (e.g., for tests and benchmarks),
+// limited to the best level supported by this CPU (default).
+
+#ifdef VIEW_WRAPPER_SIMD_X86
+#define VIEW_WRAPPER_SIMD_DISPATCH(T, level, ...)  \
+  if constexpr (detail::Vectorizable<T>) {         \
+    switch (detail::clamp(level)) {                \
+      case isa::avx512:                            \
+        return detail::avx512::__VA_ARGS__;        \
+      case isa::avx2:                              \
+        return detail::avx2::__VA_ARGS__;          \
+      case isa::sse2:                              \
+        return detail::sse2::__VA_ARGS__;          \
+      default:                                     \
+        break;                                     \
+    }                                              \
+  }
+#else
+#define VIEW_WRAPPER_SIMD_DISPATCH(T, level, ...)
+#endif
+
+template <typename R>
+auto sum(R&& r, isa level = detect_isa()) {
+  auto s = detail::as_contiguous(r);
+  using T = std::remove_cv_t<typename decltype(s)::element_type>;
+  const T* p = s.data();
+  const std::size_t n = s.size();
+  VIEW_WRAPPER_SIMD_DISPATCH(T, level, sum(p, n));
+  return detail::scalar::sum(p, n);
+}
+
+template <typename R>
+auto min(R&& r, isa level = detect_isa()) {
+  auto s = detail::as_contiguous(r);
+  using T = std::remove_cv_t<typename decltype(s)::element_type>;
+  const T* p = s.data();
+  const std::size_t n = s.size();
+  VIEW_WRAPPER_SIMD_DISPATCH(T, level, minmax<T, true>(p, n));
+  return detail::scalar::min(p, n);
+}
+
+template <typename R>
+auto max(R&& r, isa level = detect_isa()) {
+  auto s = detail::as_contiguous(r);
+  using T = std::remove_cv_t<typename decltype(s)::element_type>;
+  const T* p = s.data();
+  const std::size_t n = s.size();
+  VIEW_WRAPPER_SIMD_DISPATCH(T, level, minmax<T, false>(p, n));
+  return detail::scalar::max(p, n);
+}
+
+template <typename R, typename V>
+std::size_t count(R&& r, const V& value, isa level = detect_isa()) {
+  auto s = detail::as_contiguous(r);
+  using T = std::remove_cv_t<typename decltype(s)::element_type>;
+  const T* p = s.data();
+  const std::size_t n = s.size();
+  const T v = T(value);
+  VIEW_WRAPPER_SIMD_DISPATCH(T, level, count(p, n, v));
+  return detail::scalar::count(p, n, v);
+}
+
+// index of first element equal to value (or size, if not found)
+template <typename R, typename V>
+std::size_t find(R&& r, const V& value, isa level = detect_isa()) {
+  auto s = detail::as_contiguous(r);
+  using T = std::remove_cv_t<typename decltype(s)::element_type>;
+  const T* p = s.data();
+  const std::size_t n = s.size();
+  const T v = T(value);
+  VIEW_WRAPPER_SIMD_DISPATCH(T, level, find(p, n, v));
+  return detail::scalar::find(p, n, v);
+}
+
+template <typename R1, typename R2>
+bool equal(R1&& r1, R2&& r2, isa level = detect_isa()) {
+  auto s1 = detail::as_contiguous(r1);
+  auto s2 = detail::as_contiguous(r2);
+  using T = std::remove_cv_t<typename decltype(s1)::element_type>;
+  static_assert(
+      std::is_same_v<T, std::remove_cv_t<typename decltype(s2)::element_type>>,
+      "simd::equal requires ranges of same element type");
+  if (s1.size() != s2.size()) return false;
+  const T* a = s1.data();
+  const T* b = s2.data();
+  const std::size_t n = s1.size();
+  // integers compare bitwise: std::equal is already a vectorized memcmp
+  if constexpr (std::is_same_v<T, float>) {
+    VIEW_WRAPPER_SIMD_DISPATCH(T, level, equal(a, b, n));
+  }
+  return detail::scalar::equal(a, b, n);
+}
+
+// index of first char in set (or size, if not found)
+// Sets of 2 to 4 bytes use SSE2/AVX2 byte compares (pcmpeqb + pmovmskb);
+// AVX-512F has no byte compares, so it uses the AVX2 kernel.
+template <typename R>
+std::size_t find_first_of(R&& r, std::string_view set,
+                          isa level = detect_isa()) {
+  auto s = detail::as_contiguous(r);
+  static_assert(sizeof(typename decltype(s)::element_type) == 1,
+                "simd::find_first_of requires a range of bytes");
+  const char* p = reinterpret_cast<const char*>(s.data());
+  const std::size_t n = s.size();
+  const std::size_t k = set.size();
+  if (k == 0) return n;
+  // single byte: libc memchr is already vectorized
+  if (k == 1) {
+    const void* hit = n ? std::memchr(p, set[0], n) : nullptr;
+    return hit ? std::size_t(static_cast<const char*>(hit) - p) : n;
+  }
+#ifdef VIEW_WRAPPER_SIMD_X86
+  if (k <= 4) {
+    switch (detail::clamp(level)) {
+      case isa::avx512:
+      case isa::avx2:
+        return detail::avx2::find_first_of(p, n, set.data(), k);
+      case isa::sse2:
+        return detail::sse2::find_first_of(p, n, set.data(), k);
+      default:
+        break;
+    }
+  }
+#endif
+  return detail::scalar::find_first_of(p, n, set.data(), k);
+}
+
+#undef VIEW_WRAPPER_SIMD_DISPATCH
+
+}  // namespace view_wrapper::simd
+
+#endif  // VIEW_WRAPPER_SIMD_HPP_
@@ -0,0 +1,191 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_SLACK_VECTOR_HPP_
+#define VIEW_WRAPPER_SLACK_VECTOR_HPP_
+
+// slack_vector is a C++14 vector split into k segments, where each segment
+// keeps some slack (a gap of unused elements) after its last element.
+//
+// Appending to a segment fills its gap in O(1). When the gap is exhausted,
+// the segment capacity is doubled, moving the remote tail once, so appends
+// are amortized O(1) per segment instead of one tail move per element
+// (as with subvector::push_back on a std::vector).
+//
+// Each segment stays contiguous (begin()/end() are std::vector iterators),
+// and its slices are plain fixed-bounds subvector over the backing vector.
+// Whole-container iteration is segmented (gaps are skipped).
+//
+// Gap elements are value-initialized T (T must be default constructible).
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+//
+#include "./subvector.hpp"
+
+#if defined(__cpp_lib_span) && (__cpp_lib_span >= 202002L)
+#include <span>
+#endif
+
+namespace view_wrapper {
+
+template <typename T, typename A = std::allocator<T>>
+class slack_vector {
+ public:
+  using value_type = T;
+  using allocator_type = A;
+  using size_type = typename std::vector<T, A>::size_type;
+  using iterator = typename std::vector<T, A>::iterator;
+  using const_iterator = typename std::vector<T, A>::const_iterator;
+  using slice_type = subvector<T, A, fixed_bounds>;
+
+ private:
+  // backing store: segment i lives in [starts[i], starts[i] + sizes[i])
+  // and its gap in [starts[i] + sizes[i], starts[i + 1])
+  std::vector<T, A> remote;
+  std::vector<size_type> starts;
+  std::vector<size_type> sizes;
+  size_type count{0};
+
+ public:
+  // handle to a segment of a slack_vector (subvector-like API)
+  class segment_ref {
+   private:
+    slack_vector* owner{nullptr};
+    size_type seg{0};
+
+   public:
+    using value_type = T;
+
+    segment_ref(slack_vector* _owner, size_type _seg)
+        : owner{_owner}, seg{_seg} {}
+
+    size_type size() const { return owner->sizes[seg]; }
+    bool empty() const { return size() == 0; }
+    size_type capacity() const { return owner->segment_capacity(seg); }
+
+    iterator begin() { return owner->remote.begin() + owner->starts[seg]; }
+    iterator end() { return begin() + size(); }
+    const_iterator begin() const {
+      return owner->remote.cbegin() + owner->starts[seg];
+    }
+    const_iterator end() const { return begin() + size(); }
+
+    T& operator[](size_type idx) { return *(begin() + idx); }
+    const T& operator[](size_type idx) const { return *(begin() + idx); }
+
+    T& back() noexcept { return operator[](size() - 1); }
+
+    void push_back(T&& val) { emplace_back(std::move(val)); }
+
+    void push_back(const T& val) { emplace_back(val); }
+
+    template <typename... XArgs>
+    T& emplace_back(XArgs&&... args_build) {
+      // built first: args may alias elements moved by reserve_segment
+      T tmp(std::forward<XArgs>(args_build)...);
+      if (size() == capacity()) owner->reserve_segment(seg, 2 * size() + 1);
+      T& slot = owner->remote[owner->starts[seg] + size()];
+      slot = std::move(tmp);
+      owner->sizes[seg]++;
+      owner->count++;
+      return slot;
+    }
+
+    void pop_back() {
+      owner->sizes[seg]--;
+      owner->count--;
+      // release resources of removed element
+      owner->remote[owner->starts[seg] + size()] = T();
+    }
+
+#if defined(__cpp_lib_span) && (__cpp_lib_span >= 202002L)
+    std::span<T> as_span() { return std::span<T>{begin(), end()}; }
+#endif
+
+    std::vector<T, A> as_copy() const {
+      return std::vector<T, A>(begin(), end());
+    }
+
+    // fixed subvector over backing vector [a,b), valid until segment grows
+    slice_type slice(size_type a, size_type b) const {
+      return owner->slice(seg, a, b);
+    }
+  };
+
+  // k empty segments, each with 'slack' initial capacity
+  explicit slack_vector(size_type k, size_type slack = 0)
+      : remote(k * slack), starts(k + 1), sizes(k, 0) {
+    for (size_type i = 0; i <= k; i++) starts[i] = i * slack;
+  }
+
+  slack_vector(const slack_vector&) = delete;
+  slack_vector& operator=(const slack_vector&) = delete;
+
+  size_type num_segments() const { return sizes.size(); }
+
+  // number of elements (gaps not included)
+  size_type size() const { return count; }
+  bool empty() const { return count == 0; }
+
+  size_type segment_size(size_type seg) const { return sizes[seg]; }
+
+  size_type segment_capacity(size_type seg) const {
+    return starts[seg + 1] - starts[seg];
+  }
+
+  segment_ref segment(size_type seg) { return segment_ref(this, seg); }
+
+  // grows capacity of segment 'seg' (single tail move on remote)
+  void reserve_segment(size_type seg, size_type capacity) {
+    const size_type cap = segment_capacity(seg);
+    if (capacity <= cap) return;
+    const size_type delta = capacity - cap;
+    remote.insert(remote.begin() + starts[seg + 1], delta, T());
+    for (size_type i = seg + 1; i < starts.size(); i++) starts[i] += delta;
+  }
+
+  // removes all gaps (segments keep no slack)
+  void shrink_to_fit() {
+    size_type dst = 0;
+    for (size_type i = 0; i < sizes.size(); i++) {
+      std::move(remote.begin() + starts[i],
+                remote.begin() + starts[i] + sizes[i], remote.begin() + dst);
+      starts[i] = dst;
+      dst += sizes[i];
+    }
+    starts.back() = dst;
+    remote.erase(remote.begin() + dst, remote.end());
+  }
+
+  // fixed subvector over [a,b) of segment 'seg', valid until segment grows
+  slice_type slice(size_type seg, size_type a, size_type b) {
+    return slice_type(remote, starts[seg] + a, starts[seg] + b);
+  }
+
+  // segmented iteration: f(x) for every element, in segment order
+  template <typename F>
+  void for_each(F f) {
+    for (size_type i = 0; i < sizes.size(); i++) {
+      auto it = remote.begin() + starts[i];
+      std::for_each(it, it + sizes[i], f);
+    }
+  }
+
+  // dense copy of all segments (gaps not included)
+  std::vector<T, A> as_copy() const {
+    std::vector<T, A> out;
+    out.reserve(count);
+    for (size_type i = 0; i < sizes.size(); i++) {
+      auto it = remote.cbegin() + starts[i];
+      out.insert(out.end(), it, it + sizes[i]);
+    }
+    return out;
+  }
+};
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_SLACK_VECTOR_HPP_
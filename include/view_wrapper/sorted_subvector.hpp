@@ -0,0 +1,241 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_SORTED_SUBVECTOR_HPP_
+#define VIEW_WRAPPER_SORTED_SUBVECTOR_HPP_
+
+// sorted_subvector is a C++14 subvector that keeps its slice of the remote
+// vector ordered (by Compare), replacing hand-written lower_bound + insert:
+//
+//   std::vector<int> v = {9, 1, 5, 100, 200};
+//   sorted_subvector<int> seg(v, 0, 3);  // sorts [0, 3): 1 5 9 100 200
+//   seg.insert(7);                       // one tail move: 1 5 7 9 100 200
+//   auto it = seg.find(5);
+//   seg.merge(batch.begin(), batch.end());  // O(n + k), one tail move
+//
+// Lookups are binary searches over the slice. For read-mostly segments,
+// build_index() adds an Eytzinger (BFS-order) copy of the keys: lookups
+// then run a branchless loop whose next levels are contiguous (and
+// prefetched), instead of jumping across the slice. Any insert, erase or
+// merge drops the index, so rebuild it after a batch of updates.
+//
+// Elements are only exposed as const (writes could break the order).
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+//
+#include "./subvector.hpp"
+
+namespace view_wrapper {
+
+namespace detail {
+
+// number of trailing one bits of k
+inline unsigned trailing_ones(std::size_t k) {
+#if defined(__GNUC__) || defined(__clang__)
+  const unsigned long long z = ~static_cast<unsigned long long>(k);
+  return (z == 0) ? 64u : unsigned(__builtin_ctzll(z));
+#else
+  unsigned n = 0;
+  for (; k & 1; k >>= 1) n++;
+  return n;
+#endif
+}
+
+}  // namespace detail
+
+template <typename T, typename Compare = std::less<T>,
+          typename A = std::allocator<T>, typename B = fixed_bounds>
+class sorted_subvector {
+ public:
+  using value_type = T;
+  using key_compare = Compare;
+  using allocator_type = A;
+  using subvector_type = subvector<T, A, B>;
+  using size_type = typename subvector_type::size_type;
+  using const_iterator = typename subvector_type::const_iterator;
+  using iterator = const_iterator;
+
+ private:
+  subvector_type sv;
+  Compare comp;
+  // Eytzinger index: eytz[k] has children 2k and 2k+1 (eytz[0] unused),
+  // and eytzRank[k] is its position in the slice (empty if no index)
+  std::vector<T> eytz;
+  std::vector<size_type> eytzRank;
+
+  const subvector_type& csv() const { return sv; }
+
+  typename subvector_type::iterator mut(const_iterator pos) {
+    return sv.begin() + (pos - csv().begin());
+  }
+
+  void sort_slice() {
+    if (!std::is_sorted(sv.begin(), sv.end(), comp))
+      std::sort(sv.begin(), sv.end(), comp);
+  }
+
+  // in-order walk of the implicit tree: k-th node gets next slice position
+  void fill_rank(size_type k, size_type& next) {
+    if (k >= eytzRank.size()) return;
+    fill_rank(2 * k, next);
+    eytzRank[k] = next++;
+    fill_rank(2 * k + 1, next);
+  }
+
+  // slice position of first element e where right(e) is false
+  template <typename Right>
+  size_type eytz_search(Right right) const {
+    const size_type n = eytz.size() - 1;
+    const T* e = eytz.data();
+    size_type k = 1;
+    while (k <= n) {
+#if defined(__GNUC__) || defined(__clang__)
+      // 4 levels ahead (16 keys of one cache line, for 4-byte keys)
+      __builtin_prefetch(e + k * (sizeof(T) < 64 ? 64 / sizeof(T) : 1));
+#endif
+      k = 2 * k + (right(e[k]) ? 1 : 0);
+    }
+    // undo the right turns after the last left turn (and that left turn)
+    k >>= detail::trailing_ones(k) + 1;
+    return (k == 0) ? n : eytzRank[k];
+  }
+
+ public:
+  // whole remote vector (bounds policy B), sorted on construction
+  explicit sorted_subvector(std::vector<T, A>& _remote,
+                            Compare _comp = Compare())
+      : sv{_remote}, comp{std::move(_comp)} {
+    sort_slice();
+  }
+
+  // range [closed, open) of remote, sorted on construction (if needed)
+  sorted_subvector(std::vector<T, A>& _remote, size_type _idxBegin,
+                   size_type _idxEnd, Compare _comp = Compare())
+      : sv{_remote, _idxBegin, _idxEnd}, comp{std::move(_comp)} {
+    sort_slice();
+  }
+
+  const subvector_type& base() const { return sv; }
+  key_compare key_comp() const { return comp; }
+
+  size_type size() const { return sv.size(); }
+  bool empty() const { return sv.empty(); }
+  const T& operator[](size_type idx) const { return csv()[idx]; }
+  const_iterator begin() const { return csv().begin(); }
+  const_iterator end() const { return csv().end(); }
+
+  // === lookups: O(log n) ===
+
+  const_iterator lower_bound(const T& key) const {
+    if (has_index())
+      return begin() + eytz_search([&](const T& e) { return comp(e, key); });
+    return std::lower_bound(begin(), end(), key, comp);
+  }
+
+  const_iterator upper_bound(const T& key) const {
+    if (has_index())
+      return begin() + eytz_search([&](const T& e) { return !comp(key, e); });
+    return std::upper_bound(begin(), end(), key, comp);
+  }
+
+  std::pair<const_iterator, const_iterator> equal_range(const T& key) const {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+  // first element equivalent to key, or end()
+  const_iterator find(const T& key) const {
+    auto it = lower_bound(key);
+    return (it != end() && !comp(key, *it)) ? it : end();
+  }
+
+  bool contains(const T& key) const { return find(key) != end(); }
+
+  size_type count(const T& key) const {
+    auto r = equal_range(key);
+    return size_type(r.second - r.first);
+  }
+
+  // === edits: drop the index ===
+
+  // inserts after equivalent elements (one tail move on remote)
+  const_iterator insert(const T& value) {
+    drop_index();
+    return sv.insert(std::upper_bound(begin(), end(), value, comp), value);
+  }
+
+  const_iterator insert(T&& value) {
+    drop_index();
+    auto pos = std::upper_bound(begin(), end(), value, comp);
+    return sv.emplace(mut(pos), std::move(value));
+  }
+
+  // bulk merge-insert of a batch (sorted, or sorted here if not): one tail
+  // move for the whole batch, then an in-place O(n + k) merge
+  template <typename InputIt>
+  void merge(InputIt first, InputIt last) {
+    drop_index();
+    const size_type mid = size();
+    sv.insert(end(), first, last);
+    auto b = sv.begin();
+    auto m = b + mid;
+    auto e = sv.end();
+    if (!std::is_sorted(m, e, comp)) std::sort(m, e, comp);
+    std::inplace_merge(b, m, e, comp);
+  }
+
+  template <typename R>
+  void merge(const R& batch) {
+    using std::begin;
+    using std::end;
+    merge(begin(batch), end(batch));
+  }
+
+  const_iterator erase(const_iterator pos) {
+    drop_index();
+    return sv.erase(mut(pos));
+  }
+
+  // erases all elements equivalent to key, returns number erased
+  size_type erase(const T& key) {
+    drop_index();
+    auto r = equal_range(key);
+    const size_type n = size_type(r.second - r.first);
+    if (n > 0) sv.erase(mut(r.first), mut(r.second));
+    return n;
+  }
+
+  // === read-optimized mode ===
+
+  // builds Eytzinger index of current keys: O(n) time, n keys of memory
+  void build_index() {
+    const size_type n = size();
+    eytzRank.assign(n + 1, 0);
+    size_type next = 0;
+    fill_rank(1, next);
+    eytz.clear();
+    if (n == 0) {
+      eytzRank.clear();
+      return;
+    }
+    eytz.reserve(n + 1);
+    eytz.push_back((*this)[0]);  // unused slot
+    for (size_type k = 1; k <= n; k++) eytz.push_back((*this)[eytzRank[k]]);
+  }
+
+  bool has_index() const { return !eytz.empty(); }
+
+  void drop_index() {
+    eytz.clear();
+    eytzRank.clear();
+  }
+};
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_SORTED_SUBVECTOR_HPP_
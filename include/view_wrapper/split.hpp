@@ -0,0 +1,192 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_SPLIT_HPP_
+#define VIEW_WRAPPER_SPLIT_HPP_
+
+// split() is a lazy, zero-copy tokenizer over View<std::string>:
+// fields are yielded as View<std::string> over the original text, and
+// delimiters are found with SIMD byte search (simd::find_first_of).
+//
+// Examples:
+//   for (auto field : split(View<std::string>(line), ","))
+//     std::cout << *field << std::endl;
+//   for (auto field : split(View<std::string>(csv), ",\n", split_mode::csv))
+//     ...
+//
+// In csv mode, a field starting with '"' ends at the matching closing
+// quote (doubled quotes "" are escapes, and may contain delimiters).
+// The yielded field excludes the outer quotes, but keeps "" escapes
+// as-is (unescaping would require a copy).
+//
+// Each field knows the delimiter that ended it (iterator::delimiter(),
+// or '\0' for the last one), e.g., to detect '\n' record boundaries.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <string_view>
+//
+#include "./View.hpp"
+#include "./simd.hpp"
+
+namespace view_wrapper {
+
+enum class split_mode { plain, csv };
+
+class split_view : public std::ranges::view_interface<split_view> {
+ public:
+  // up to 4 delimiters are searched with SIMD; longer delimiter sets
+  // use a 256-bit lookup table (one test per byte, for any set size)
+  static constexpr std::size_t max_delims = 4;
+
+ private:
+  std::string_view text;
+  // delimiters are copied: no dangling on temporary delimiter strings
+  std::array<char, max_delims> delims{};
+  std::size_t numDelims{0};
+  // bit c is set for each delimiter byte c (only for long delimiter sets)
+  std::array<std::uint64_t, 4> table{};
+  bool useTable{false};
+  split_mode mode{split_mode::plain};
+
+  // position of first delimiter in s, or s.size()
+  std::size_t find_delim(std::string_view s) const {
+    if (!useTable)
+      return simd::find_first_of(s, std::string_view{delims.data(), numDelims});
+    for (std::size_t i = 0; i < s.size(); i++) {
+      const auto c = static_cast<unsigned char>(s[i]);
+      if ((table[c >> 6] >> (c & 63)) & 1) return i;
+    }
+    return s.size();
+  }
+
+ public:
+  class iterator {
+   private:
+    const split_view* parent{nullptr};
+    // current field
+    std::string_view field;
+    // start of next field (npos when current field is the last one)
+    std::size_t next{0};
+    char delim{'\0'};
+    bool done{true};
+
+    void parse(std::size_t pos) {
+      std::string_view rest = parent->text.substr(pos);
+      std::size_t start = 0;
+      std::size_t end = 0;
+      if (parent->mode == split_mode::csv && !rest.empty() && rest[0] == '"') {
+        // quoted field: find closing quote, skipping "" escapes
+        std::size_t q = 1;
+        while (true) {
+          q += simd::find_first_of(rest.substr(q), "\"");
+          if (q + 1 < rest.size() && rest[q + 1] == '"') {
+            q += 2;
+            continue;
+          }
+          break;
+        }
+        start = 1;
+        end = std::min(q, rest.size());
+        // delimiter after closing quote (ignores anything in between)
+        std::size_t after = std::min(q + 1, rest.size());
+        std::size_t d = after + parent->find_delim(rest.substr(after));
+        setField(pos, rest, start, end, d);
+        return;
+      }
+      end = parent->find_delim(rest);
+      setField(pos, rest, start, end, end);
+    }
+
+    void setField(std::size_t pos, std::string_view rest, std::size_t start,
+                  std::size_t end, std::size_t d) {
+      field = rest.substr(start, end - start);
+      if (d < rest.size()) {
+        delim = rest[d];
+        next = pos + d + 1;
+      } else {
+        delim = '\0';
+        next = std::string_view::npos;
+      }
+    }
+
+   public:
+    using value_type = View<std::string>;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    iterator() = default;
+
+    explicit iterator(const split_view* _parent)
+        : parent{_parent}, done{false} {
+      parse(0);
+    }
+
+    View<std::string> operator*() const {
+      std::string_view f = field;
+      return View<std::string>(f);
+    }
+
+    // delimiter that ended current field ('\0' for the last field)
+    char delimiter() const { return delim; }
+
+    iterator& operator++() {
+      if (next == std::string_view::npos)
+        done = true;
+      else
+        parse(next);
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator it = *this;
+      ++*this;
+      return it;
+    }
+
+    bool operator==(const iterator& other) const {
+      if (done || other.done) return done == other.done;
+      return field.data() == other.field.data();
+    }
+
+    bool operator==(std::default_sentinel_t) const { return done; }
+  };
+
+  split_view() = default;
+
+  split_view(View<std::string> v, std::string_view _delims,
+             split_mode _mode = split_mode::plain)
+      : text{v.as_view()}, mode{_mode} {
+    if (_delims.size() > max_delims) {
+      useTable = true;
+      for (char ch : _delims) {
+        const auto c = static_cast<unsigned char>(ch);
+        table[c >> 6] |= std::uint64_t(1) << (c & 63);
+      }
+      return;
+    }
+    numDelims = _delims.size();
+    std::copy_n(_delims.begin(), numDelims, delims.begin());
+  }
+
+  iterator begin() const { return iterator(this); }
+  std::default_sentinel_t end() const { return std::default_sentinel; }
+};
+
+// lazy zero-copy split of v by any char in delims
+inline split_view split(View<std::string> v, std::string_view delims,
+                        split_mode mode = split_mode::plain) {
+  return split_view(v, delims, mode);
+}
+
+static_assert(std::forward_iterator<split_view::iterator>);
+static_assert(std::ranges::forward_range<split_view>);
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_SPLIT_HPP_
@@ -0,0 +1,240 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_STRIDED_SUBVECTOR_HPP_
+#define VIEW_WRAPPER_STRIDED_SUBVECTOR_HPP_
+
+// Non-contiguous C++20 views over a remote std::vector, without copying:
+//
+// - strided_subvector<T>: count elements from start, every stride-th one
+//     strided_subvector<float> even(v, 0, v.size() / 2, 2);
+// - field_view<&S::member>: projection of one field of std::vector<S>
+//     field_view<&particle::mass> masses(particles);
+//
+// Both are random-access ranges with slice(a, b) (as subvector), so they
+// also work with parallel algorithms (parallel.hpp). As subvector, they
+// refer to remote by pointer: remote must not reallocate while viewed.
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace view_wrapper {
+
+namespace detail {
+
+struct identity_proj {
+  template <typename S>
+  static S& get(S& s) {
+    return s;
+  }
+};
+
+template <auto Member>
+struct member_proj {
+  template <typename S>
+  static auto& get(S& s) {
+    return s.*Member;
+  }
+};
+
+// random-access iterator over Proj::get(base[idx * step])
+template <typename S, typename Proj>
+class gather_iterator {
+ private:
+  S* base{nullptr};
+  std::ptrdiff_t step{1};
+  std::ptrdiff_t idx{0};
+
+ public:
+  using reference = decltype(Proj::get(std::declval<S&>()));
+  using value_type = std::remove_cvref_t<reference>;
+  using difference_type = std::ptrdiff_t;
+  using iterator_concept = std::random_access_iterator_tag;
+  using iterator_category = std::random_access_iterator_tag;
+
+  gather_iterator() = default;
+  gather_iterator(S* _base, std::ptrdiff_t _step, std::ptrdiff_t _idx)
+      : base{_base}, step{_step}, idx{_idx} {}
+
+  reference operator*() const { return Proj::get(base[idx * step]); }
+  reference operator[](difference_type n) const {
+    return Proj::get(base[(idx + n) * step]);
+  }
+
+  gather_iterator& operator++() {
+    ++idx;
+    return *this;
+  }
+  gather_iterator operator++(int) {
+    gather_iterator it = *this;
+    ++idx;
+    return it;
+  }
+  gather_iterator& operator--() {
+    --idx;
+    return *this;
+  }
+  gather_iterator operator--(int) {
+    gather_iterator it = *this;
+    --idx;
+    return it;
+  }
+  gather_iterator& operator+=(difference_type n) {
+    idx += n;
+    return *this;
+  }
+  gather_iterator& operator-=(difference_type n) {
+    idx -= n;
+    return *this;
+  }
+  friend gather_iterator operator+(gather_iterator it, difference_type n) {
+    return it += n;
+  }
+  friend gather_iterator operator+(difference_type n, gather_iterator it) {
+    return it += n;
+  }
+  friend gather_iterator operator-(gather_iterator it, difference_type n) {
+    return it -= n;
+  }
+  friend difference_type operator-(const gather_iterator& a,
+                                   const gather_iterator& b) {
+    return a.idx - b.idx;
+  }
+  friend bool operator==(const gather_iterator& a, const gather_iterator& b) {
+    return a.idx == b.idx;
+  }
+  friend auto operator<=>(const gather_iterator& a, const gather_iterator& b) {
+    return a.idx <=> b.idx;
+  }
+};
+
+template <typename M>
+struct member_pointer_traits;
+
+template <typename S, typename F>
+struct member_pointer_traits<F S::*> {
+  using object_type = S;
+  using field_type = F;
+};
+
+}  // namespace detail
+
+template <typename T, typename A = std::allocator<T>>
+class strided_subvector {
+ public:
+  using value_type = T;
+  using allocator_type = A;
+  using size_type = typename std::vector<T, A>::size_type;
+  using iterator = detail::gather_iterator<T, detail::identity_proj>;
+
+ private:
+  std::vector<T, A>* remote{nullptr};
+  size_type start{0};
+  size_type count{0};
+  size_type step{1};
+
+ public:
+  // every element of remote
+  explicit strided_subvector(std::vector<T, A>& _remote)
+      : remote{&_remote}, count{_remote.size()} {}
+
+  // remote[start + i * stride], for i in [0, count)
+  strided_subvector(std::vector<T, A>& _remote, size_type _start,
+                    size_type _count, size_type _stride)
+      : remote{&_remote}, start{_start}, count{_count}, step{_stride} {}
+
+  size_type size() const { return count; }
+  bool empty() const { return count == 0; }
+  size_type stride() const { return step; }
+
+  T& operator[](size_type idx) const {
+    return (*remote)[start + idx * step];
+  }
+
+  iterator begin() const {
+    return iterator(remote->data() + start, std::ptrdiff_t(step), 0);
+  }
+  iterator end() const {
+    return iterator(remote->data() + start, std::ptrdiff_t(step),
+                    std::ptrdiff_t(count));
+  }
+
+  // slice into [a,b) (in strided positions)
+  strided_subvector slice(size_type a, size_type b) const {
+    return strided_subvector(*remote, start + a * step, b - a, step);
+  }
+
+  // every k-th element of this view (throws std::invalid_argument if k == 0)
+  strided_subvector strided(size_type k) const {
+    if (k == 0)
+      throw std::invalid_argument("strided_subvector: strided(0)");
+    return strided_subvector(*remote, start, (count + k - 1) / k, step * k);
+  }
+
+  std::vector<T, A> as_copy() const {
+    return std::vector<T, A>(begin(), end(), remote->get_allocator());
+  }
+};
+
+// projection of field Member of each element in [idxBegin, idxEnd)
+template <auto Member,
+          typename A = std::allocator<typename detail::member_pointer_traits<
+              decltype(Member)>::object_type>>
+class field_view {
+ public:
+  using object_type =
+      typename detail::member_pointer_traits<decltype(Member)>::object_type;
+  using value_type =
+      typename detail::member_pointer_traits<decltype(Member)>::field_type;
+  using size_type = typename std::vector<object_type, A>::size_type;
+  using iterator =
+      detail::gather_iterator<object_type, detail::member_proj<Member>>;
+
+ private:
+  std::vector<object_type, A>* remote{nullptr};
+  size_type idxBegin{0}, idxEnd{0};
+
+ public:
+  explicit field_view(std::vector<object_type, A>& _remote)
+      : remote{&_remote}, idxEnd{_remote.size()} {}
+
+  field_view(std::vector<object_type, A>& _remote, size_type _idxBegin,
+             size_type _idxEnd)
+      : remote{&_remote}, idxBegin{_idxBegin}, idxEnd{_idxEnd} {}
+
+  size_type size() const { return idxEnd - idxBegin; }
+  bool empty() const { return size() == 0; }
+
+  value_type& operator[](size_type idx) const {
+    return (*remote)[idxBegin + idx].*Member;
+  }
+
+  iterator begin() const { return iterator(remote->data() + idxBegin, 1, 0); }
+  iterator end() const {
+    return iterator(remote->data() + idxBegin, 1, std::ptrdiff_t(size()));
+  }
+
+  field_view slice(size_type a, size_type b) const {
+    return field_view(*remote, idxBegin + a, idxBegin + b);
+  }
+
+  // gathered copy of the field
+  std::vector<value_type> as_copy() const {
+    return std::vector<value_type>(begin(), end());
+  }
+};
+
+static_assert(std::random_access_iterator<strided_subvector<int>::iterator>);
+static_assert(std::ranges::random_access_range<strided_subvector<int>>);
+static_assert(std::ranges::sized_range<strided_subvector<int>>);
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_STRIDED_SUBVECTOR_HPP_
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_STRING_POOL_HPP_
+#define VIEW_WRAPPER_STRING_POOL_HPP_
+
+// string_pool is a C++20 string interner: each distinct string is copied
+// once into a bump_arena, and intern() returns an interned_string, which
+// is a View<std::string> over pool storage that also carries its hash
+// (computed once). Handles stay valid for the lifetime of the pool.
+//
+//   string_pool pool;
+//   interned_string k = pool.intern("user:42");
+//   std::unordered_map<interned_string, int, string_hash, string_equal> m;
+//   m[k] = 1;
+//   m.find(k);                               // cached hash, pointer equality
+//   m.find(std::string_view("user:42"));     // transparent: no allocation
+//   pool.find("user:42");                    // no allocation (null if absent)
+//
+// string_hash and string_equal are transparent (std::string_view,
+// std::string, View<std::string> and interned_string), and agree with
+// std::hash<std::string_view>, so lookups from any of them never allocate.
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+//
+#include "./View.hpp"
+#include "./arena.hpp"
+
+namespace view_wrapper {
+
+// View<std::string> over interned storage, with precomputed hash
+class interned_string : public View<std::string> {
+ private:
+  std::size_t h{0};
+
+ public:
+  // null handle (e.g., string_pool::find of a missing string)
+  interned_string() : interned_string(std::string_view{}, 0) {}
+
+  interned_string(std::string_view s, std::size_t _h)
+      : View<std::string>{s}, h{_h} {}
+
+  std::size_t hash() const { return h; }
+
+  const char* data() const { return as_string_view().data(); }
+  std::size_t size() const { return as_string_view().size(); }
+
+  // same pool: equal strings have same storage (pointer comparison)
+  friend bool operator==(const interned_string& a, const interned_string& b) {
+    return a.data() == b.data() ||
+           (a.h == b.h && a.as_string_view() == b.as_string_view());
+  }
+  friend bool operator==(const interned_string& a, std::string_view b) {
+    return a.as_string_view() == b;
+  }
+};
+
+static_assert(std::is_trivially_copyable_v<interned_string>);
+
+namespace detail {
+
+inline std::string_view string_view_of(std::string_view s) { return s; }
+inline std::string_view string_view_of(const char* s) { return s; }
+inline std::string_view string_view_of(const std::string& s) { return s; }
+inline std::string_view string_view_of(const View<std::string>& s) {
+  return s.as_string_view();
+}
+
+}  // namespace detail
+
+// transparent hash: cached for interned_string, std::string_view otherwise
+struct string_hash {
+  using is_transparent = void;
+
+  std::size_t operator()(const interned_string& s) const { return s.hash(); }
+
+  template <typename S>
+  std::size_t operator()(const S& s) const {
+    return std::hash<std::string_view>{}(detail::string_view_of(s));
+  }
+};
+
+// transparent equality: pointer fast path for interned_string pairs
+struct string_equal {
+  using is_transparent = void;
+
+  bool operator()(const interned_string& a, const interned_string& b) const {
+    return a == b;
+  }
+
+  template <typename S1, typename S2>
+  bool operator()(const S1& a, const S2& b) const {
+    return detail::string_view_of(a) == detail::string_view_of(b);
+  }
+};
+
+class string_pool {
+ private:
+  bump_arena arena;
+  // open addressing (linear probing), power-of-two size, null if empty
+  std::vector<interned_string> slots;
+  std::size_t count{0};
+
+  // slot of s, or first empty slot of its probe sequence
+  std::size_t probe(std::string_view s, std::size_t h) const {
+    const std::size_t mask = slots.size() - 1;
+    std::size_t i = h & mask;
+    while (slots[i].has_value() &&
+           (slots[i].hash() != h || slots[i].as_string_view() != s))
+      i = (i + 1) & mask;
+    return i;
+  }
+
+  // doubles slots, reusing cached hashes (no string is rehashed)
+  void grow() {
+    std::vector<interned_string> old(2 * slots.size());
+    old.swap(slots);
+    const std::size_t mask = slots.size() - 1;
+    for (const auto& e : old) {
+      if (!e.has_value()) continue;
+      std::size_t i = e.hash() & mask;
+      while (slots[i].has_value()) i = (i + 1) & mask;
+      slots[i] = e;
+    }
+  }
+
+ public:
+  explicit string_pool(std::size_t blockSize = 64 * 1024)
+      : arena{blockSize}, slots(16) {}
+
+  string_pool(const string_pool&) = delete;
+  string_pool& operator=(const string_pool&) = delete;
+
+  // handle of s, copying s into the pool on first use
+  interned_string intern(std::string_view s) {
+    const std::size_t h = std::hash<std::string_view>{}(s);
+    std::size_t i = probe(s, h);
+    if (slots[i].has_value()) return slots[i];
+    // max load factor 1/2
+    if (2 * (count + 1) > slots.size()) {
+      grow();
+      i = probe(s, h);
+    }
+    // non-null storage, even for empty strings
+    auto* p = static_cast<char*>(arena.allocate(s.size() ? s.size() : 1, 1));
+    if (!s.empty()) std::memcpy(p, s.data(), s.size());
+    slots[i] = interned_string(std::string_view(p, s.size()), h);
+    count++;
+    return slots[i];
+  }
+
+  // handle of s if interned, else null handle (never allocates)
+  interned_string find(std::string_view s) const {
+    return slots[probe(s, std::hash<std::string_view>{}(s))];
+  }
+
+  bool contains(std::string_view s) const { return find(s).has_value(); }
+
+  // number of distinct strings
+  std::size_t size() const { return count; }
+
+  // bytes of interned characters
+  std::size_t bytes_used() const { return arena.bytes_used(); }
+
+  // total memory held: arena blocks and hash table
+  std::size_t memory_bytes() const {
+    return arena.capacity() + slots.capacity() * sizeof(interned_string);
+  }
+};
+
+}  // namespace view_wrapper
+
+template <>
+struct std::hash<view_wrapper::interned_string> {
+  std::size_t operator()(const view_wrapper::interned_string& s) const {
+    return s.hash();
+  }
+};
+
+#endif  // VIEW_WRAPPER_STRING_POOL_HPP_
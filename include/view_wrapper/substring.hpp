@@ -0,0 +1,300 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_SUBSTRING_HPP_
+#define VIEW_WRAPPER_SUBSTRING_HPP_
+
+// substring is a C++17 string-compatible range type, mirroring subvector
+// over std::basic_string: it refers to [idxBegin, idxEnd) of a remote
+// string, and every edit (insert, append, erase, replace) writes through
+// to the remote string, so text can be rewritten in place:
+//
+//   std::string page = "Hello, {{name}}!";
+//   substring field(page, 7, 15);
+//   field.replace(0, field.size(), "World");  // page is "Hello, World!"
+//
+// Bounds use the same policies as subvector (fixed_bounds, full_bounds,
+// lambda_bounds, or the default type-erased basic_function_bounds).
+//
+// Edits forward to std::basic_string members, so each one moves the
+// remote tail once, and only allocates when the remote needs to grow.
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+//
+#include "./subvector.hpp"
+
+namespace view_wrapper {
+
+template <typename CharT, typename Traits = std::char_traits<CharT>,
+          typename A = std::allocator<CharT>,
+          typename B =
+              basic_function_bounds<std::basic_string<CharT, Traits, A>>>
+class basic_substring : private B {
+ public:
+  using string_type = std::basic_string<CharT, Traits, A>;
+  using string_view_type = std::basic_string_view<CharT, Traits>;
+  using value_type = CharT;
+  using traits_type = Traits;
+  using allocator_type = A;
+  using bounds_type = B;
+  using size_type = typename string_type::size_type;
+  using iterator = typename string_type::iterator;
+  using const_iterator = typename string_type::const_iterator;
+
+  static constexpr size_type npos = string_type::npos;
+
+ private:
+  // immutable, but nullable
+  string_type* remote{nullptr};
+  size_type idxBegin{0}, idxEnd{0};
+
+  // throws std::out_of_range when pos > size (as std::string does)
+  VIEW_WRAPPER_CONSTEXPR20 void check_pos(size_type pos) const {
+    if (pos > idxEnd - idxBegin)
+      throw std::out_of_range("basic_substring: pos > size()");
+  }
+
+  // clamps count to [pos, size) (as std::string does)
+  VIEW_WRAPPER_CONSTEXPR20 size_type clamp(size_type pos,
+                                           size_type count) const {
+    check_pos(pos);
+    const size_type sz = idxEnd - idxBegin;
+    return (count > sz - pos) ? sz - pos : count;
+  }
+
+ public:
+  // bounds policy (e.g., to inspect stateful policies)
+  VIEW_WRAPPER_CONSTEXPR20 const B& bounds() const { return *this; }
+
+  // full string: dynamic bounds [0, size) (or fixed, for fixed_bounds)
+  VIEW_WRAPPER_CONSTEXPR20 explicit basic_substring(string_type& _remote)
+      : B{B::whole()}, remote{&_remote}, idxBegin{0}, idxEnd{_remote.size()} {
+    refresh();
+  }
+
+  // fixed-range of string in format [closed, open)
+  VIEW_WRAPPER_CONSTEXPR20 basic_substring(string_type& _remote,
+                                           size_type _idxBegin,
+                                           size_type _idxEnd)
+      : remote{&_remote}, idxBegin{_idxBegin}, idxEnd{_idxEnd} {}
+
+  // dynamic-range of string: arguments are forwarded to bounds policy B
+  template <typename F, typename... Flags,
+            typename = typename std::enable_if<
+                std::is_constructible<B, F&&, Flags...>::value>::type>
+  VIEW_WRAPPER_CONSTEXPR20 basic_substring(string_type& _remote, F&& _fBounds,
+                                           Flags... flags)
+      : B(std::forward<F>(_fBounds), flags...), remote{&_remote} {
+    refresh();
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 void refresh() const {
+    auto& thisConstless = const_cast<basic_substring&>(*this);
+    bounds().refresh(*remote, thisConstless.idxBegin, thisConstless.idxEnd);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 string_view_type as_string_view() const {
+    return string_view_type{remote->data() + idxBegin, idxEnd - idxBegin};
+  }
+
+  // copy uses the allocator of remote string
+  VIEW_WRAPPER_CONSTEXPR20 string_type as_copy() const {
+    return as_copy(remote->get_allocator());
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 string_type as_copy(const A& alloc) const {
+    VIEW_WRAPPER_COUNT(as_copy, 1);
+    VIEW_WRAPPER_COUNT(bytes_copied, (idxEnd - idxBegin) * sizeof(CharT));
+    return string_type(remote->data() + idxBegin, idxEnd - idxBegin, alloc);
+  }
+
+  // copy into out, reusing its capacity
+  void copy_into(string_type& out) const {
+    detail::bulk_copy(remote->data() + idxBegin, idxEnd - idxBegin, out);
+  }
+
+  // copy to output iterator (e.g., raw pointer or std::back_inserter)
+  template <typename OutIt>
+  OutIt copy_into(OutIt out) const {
+    return detail::bulk_copy(remote->data() + idxBegin, idxEnd - idxBegin,
+                             out);
+  }
+
+  // slice substring into [a,b)
+  VIEW_WRAPPER_CONSTEXPR20
+      basic_substring<CharT, Traits, A, typename B::slice_policy>
+      slice(size_type a, size_type b) const {
+    if (bounds().refresh_on_size()) refresh();
+    return basic_substring<CharT, Traits, A, typename B::slice_policy>(
+        *remote, idxBegin + a, idxBegin + b);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 size_type size() const {
+    if (bounds().refresh_on_size()) refresh();
+    return idxEnd - idxBegin;
+  }
+  VIEW_WRAPPER_CONSTEXPR20 size_type length() const { return size(); }
+  VIEW_WRAPPER_CONSTEXPR20 bool empty() const { return size() == 0; }
+
+  VIEW_WRAPPER_CONSTEXPR20 CharT& operator[](size_type idx) {
+    return (*remote)[idxBegin + idx];
+  }
+  VIEW_WRAPPER_CONSTEXPR20 const CharT& operator[](size_type idx) const {
+    return (*remote)[idxBegin + idx];
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 CharT* data() { return &(*remote)[0] + idxBegin; }
+  VIEW_WRAPPER_CONSTEXPR20 const CharT* data() const {
+    return remote->data() + idxBegin;
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 iterator begin() {
+    return remote->begin() + idxBegin;
+  }
+  VIEW_WRAPPER_CONSTEXPR20 iterator end() { return remote->begin() + idxEnd; }
+  VIEW_WRAPPER_CONSTEXPR20 const_iterator begin() const {
+    return remote->begin() + idxBegin;
+  }
+  VIEW_WRAPPER_CONSTEXPR20 const_iterator end() const {
+    return remote->begin() + idxEnd;
+  }
+
+  // === write-through edits (positions are relative to substring) ===
+
+  VIEW_WRAPPER_CONSTEXPR20 void push_back(CharT ch) {
+    if (bounds().refresh_before_push_pop()) refresh();
+    remote->insert(remote->begin() + idxEnd, ch);
+    idxEnd++;
+    bounds().grow(1);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 void pop_back() {
+    if (bounds().refresh_before_push_pop()) refresh();
+    idxEnd--;
+    remote->erase(idxEnd, 1);
+    bounds().shrink(1);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 basic_substring& insert(size_type pos,
+                                                   string_view_type s) {
+    check_pos(pos);
+    remote->insert(idxBegin + pos, s.data(), s.size());
+    idxEnd += s.size();
+    bounds().grow(s.size());
+    return *this;
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 basic_substring& insert(size_type pos,
+                                                   size_type count, CharT ch) {
+    check_pos(pos);
+    remote->insert(idxBegin + pos, count, ch);
+    idxEnd += count;
+    bounds().grow(count);
+    return *this;
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 basic_substring& append(string_view_type s) {
+    if (bounds().refresh_before_push_pop()) refresh();
+    return insert(idxEnd - idxBegin, s);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 basic_substring& append(size_type count, CharT ch) {
+    if (bounds().refresh_before_push_pop()) refresh();
+    return insert(idxEnd - idxBegin, count, ch);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 basic_substring& operator+=(string_view_type s) {
+    return append(s);
+  }
+  VIEW_WRAPPER_CONSTEXPR20 basic_substring& operator+=(CharT ch) {
+    push_back(ch);
+    return *this;
+  }
+
+  // erases [pos, pos + count) (count is clamped to substring end)
+  VIEW_WRAPPER_CONSTEXPR20 basic_substring& erase(size_type pos = 0,
+                                                  size_type count = npos) {
+    count = clamp(pos, count);
+    remote->erase(idxBegin + pos, count);
+    idxEnd -= count;
+    bounds().shrink(count);
+    return *this;
+  }
+
+  // replaces [pos, pos + count) by s, with a single remote tail move
+  VIEW_WRAPPER_CONSTEXPR20 basic_substring& replace(size_type pos,
+                                                    size_type count,
+                                                    string_view_type s) {
+    count = clamp(pos, count);
+    remote->replace(idxBegin + pos, count, s.data(), s.size());
+    idxEnd = idxEnd - count + s.size();
+    if (s.size() > count) bounds().grow(s.size() - count);
+    if (s.size() < count) bounds().shrink(count - s.size());
+    return *this;
+  }
+
+  // replaces whole substring contents
+  VIEW_WRAPPER_CONSTEXPR20 basic_substring& assign(string_view_type s) {
+    if (bounds().refresh_before_push_pop()) refresh();
+    return replace(0, idxEnd - idxBegin, s);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 void clear() { erase(); }
+
+  // read-only helpers (as std::string_view)
+  VIEW_WRAPPER_CONSTEXPR20 size_type find(string_view_type s,
+                                          size_type pos = 0) const {
+    return as_string_view().find(s, pos);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 int compare(string_view_type s) const {
+    return as_string_view().compare(s);
+  }
+
+  friend VIEW_WRAPPER_CONSTEXPR20 bool operator==(const basic_substring& a,
+                                                  string_view_type b) {
+    return a.as_string_view() == b;
+  }
+};
+
+using substring = basic_substring<char>;
+using wsubstring = basic_substring<wchar_t>;
+
+// helper for user-defined lambda_bounds (no std::function type erasure)
+template <typename CharT, typename Traits, typename A, typename F>
+VIEW_WRAPPER_CONSTEXPR20 basic_substring<
+    CharT, Traits, A, lambda_bounds<typename std::decay<F>::type>>
+make_substring(std::basic_string<CharT, Traits, A>& _remote, F&& _fBounds) {
+  return basic_substring<CharT, Traits, A,
+                         lambda_bounds<typename std::decay<F>::type>>(
+      _remote, std::forward<F>(_fBounds));
+}
+
+}  // namespace view_wrapper
+
+// as subvector, basic_substring is a borrowed view over the remote string
+#if defined(__cpp_lib_ranges) && (__cpp_lib_ranges >= 201911L)
+template <typename CharT, typename Traits, typename A, typename B>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    view_wrapper::basic_substring<CharT, Traits, A, B>> = true;
+template <typename CharT, typename Traits, typename A, typename B>
+inline constexpr bool std::ranges::enable_view<
+    view_wrapper::basic_substring<CharT, Traits, A, B>> = true;
+
+namespace view_wrapper {
+
+static_assert(std::ranges::contiguous_range<substring>);
+static_assert(std::ranges::sized_range<substring>);
+static_assert(std::ranges::view<substring>);
+static_assert(std::ranges::borrowed_range<substring>);
+
+}  // namespace view_wrapper
+#endif
+
+#endif  // VIEW_WRAPPER_SUBSTRING_HPP_
@@ -14,11 +14,22 @@
 
 // #include <cassert>
 //
+#include <algorithm>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <functional>
+#include <initializer_list>
+#include <limits>
 #include <memory>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
+//
+#include "./copy_into.hpp"
+#include "./instrumentation.hpp"
 
 #if defined(__cpp_lib_ranges) && (__cpp_lib_ranges >= 201911L)
 #include <ranges>
@@ -28,8 +39,200 @@
 #include <span>
 #endif
 
+#if __cplusplus >= 201703L
+#include <optional>
+#endif
+
+// constexpr in C++20 (constexpr std::vector), nothing in C++14/17
+#if defined(__cpp_lib_constexpr_vector) && \
+    (__cpp_lib_constexpr_vector >= 201907L)
+#define VIEW_WRAPPER_CONSTEXPR20 constexpr
+#else
+#define VIEW_WRAPPER_CONSTEXPR20
+#endif
+
+// C++20: dynamic bounds in a std::optional, which (unlike std::function)
+// is constexpr-destructible when empty
+#if defined(__cpp_lib_constexpr_vector) && \
+    (__cpp_lib_constexpr_vector >= 201907L) && \
+    defined(__cpp_lib_optional) && (__cpp_lib_optional >= 202106L)
+#define VIEW_WRAPPER_OPTIONAL_BOUNDS 1
+#endif
+
 namespace view_wrapper {
 
+// =================================================
+// Bounds policies for subvector
+//
+// A bounds policy decides how [idxBegin, idxEnd) is recomputed from the
+// remote vector on refresh(), and when refresh() is automatically invoked
+// (on size() and/or before push/pop write operations).
+//
+// Policies are resolved at compile time, so non type-erased ones are fully
+// inlined: subvector<T, A, full_bounds>::size() is just remote->size().
+//
+// A policy provides:
+//   - refresh_on_size() and refresh_before_push_pop() flags
+//   - refresh(remote, idxBegin, idxEnd): updates bounds (may be a no-op)
+//   - grow(n) and shrink(n): notified after this subvector inserts/erases
+//     n elements on remote (no-op, unless someone else tracks the bounds)
+//   - slice_policy: the policy of subvectors returned by slice(a, b)
+//   - (optional) static whole(): policy used by subvector(remote) constructor
+// =================================================
+
+// fixed bounds: [idxBegin, idxEnd) never changes on refresh()
+struct fixed_bounds {
+  using slice_policy = fixed_bounds;
+
+  static constexpr bool refresh_on_size() { return false; }
+  static constexpr bool refresh_before_push_pop() { return false; }
+
+  template <typename V, typename S>
+  constexpr void refresh(const V&, S&, S&) const {}
+  template <typename S>
+  constexpr void grow(S) const {}
+  template <typename S>
+  constexpr void shrink(S) const {}
+
+  static constexpr fixed_bounds whole() { return fixed_bounds{}; }
+};
+
+// full vector bounds: always [0, size)
+struct full_bounds {
+  using slice_policy = fixed_bounds;
+
+  static constexpr bool refresh_on_size() { return true; }
+  static constexpr bool refresh_before_push_pop() { return true; }
+
+  template <typename V, typename S>
+  constexpr void refresh(const V& v, S& idxBegin, S& idxEnd) const {
+    idxBegin = 0;
+    idxEnd = v.size();
+  }
+  template <typename S>
+  constexpr void grow(S) const {}
+  template <typename S>
+  constexpr void shrink(S) const {}
+
+  static constexpr full_bounds whole() { return full_bounds{}; }
+};
+
+// user-defined dynamic bounds: F(remote) returns pair (idxBegin, idxEnd)
+// Flags are compile-time, so no runtime check happens on size() or push/pop.
+template <typename F, bool RefreshOnSize = true,
+          bool RefreshBeforePushPop = true>
+class lambda_bounds {
+ private:
+  F fBounds;
+
+ public:
+  using slice_policy = fixed_bounds;
+
+  constexpr explicit lambda_bounds(F _fBounds)
+      : fBounds{std::move(_fBounds)} {}
+
+  static constexpr bool refresh_on_size() { return RefreshOnSize; }
+  static constexpr bool refresh_before_push_pop() {
+    return RefreshBeforePushPop;
+  }
+
+  template <typename V, typename S>
+  constexpr void refresh(const V& v, S& idxBegin, S& idxEnd) const {
+    auto p = fBounds(v);
+    idxBegin = p.first;
+    idxEnd = p.second;
+  }
+  template <typename S>
+  constexpr void grow(S) const {}
+  template <typename S>
+  constexpr void shrink(S) const {}
+};
+
+// type-erased dynamic bounds (default policy): fixed bounds when empty,
+// whole container [0, size) for whole(), otherwise std::function with
+// runtime refresh flags.
+// C is the remote container (std::vector<T, A> for subvector).
+// The std::function is held by pointer, so fixed and whole bounds do not
+// construct it (and are usable in C++20 constant evaluation).
+template <typename C>
+class basic_function_bounds {
+ public:
+  using size_type = typename C::size_type;
+  using fBoundsType = std::function<std::pair<size_type, size_type>(const C&)>;
+  // keep slices on the same (default) subvector type
+  using slice_policy = basic_function_bounds<C>;
+
+ private:
+  // dynamic bounds (empty if none)
+#ifdef VIEW_WRAPPER_OPTIONAL_BOUNDS
+  std::optional<fBoundsType> fBounds;
+#else
+  fBoundsType fBounds;
+#endif
+  // whole container bounds [0, size) (no type erasure)
+  bool wholeBounds{false};
+  // === refresh bounds strategies ===
+  // 0. must refresh on size() call
+  bool refreshOnSize{false};
+  // 1. must refresh before push/pop write operation
+  //   => middle iterator-based 'emplace', 'insert', 'erase', not included...
+  //      otherwise, they would be doubly executed on push_back, pop_front!
+  //      another reason is that users can manually invoke 'refresh' if needed!
+  bool refreshBeforePushPop{false};
+
+ public:
+  // fixed bounds
+  VIEW_WRAPPER_CONSTEXPR20 basic_function_bounds() = default;
+
+  // dynamic bounds
+  basic_function_bounds(fBoundsType _fBounds,  // NOLINT
+                        bool _refreshOnSize = true,
+                        bool _refreshBeforePushPop = true)
+      : fBounds{std::move(_fBounds)},
+        refreshOnSize{_refreshOnSize},
+        refreshBeforePushPop{_refreshBeforePushPop} {}
+
+  VIEW_WRAPPER_CONSTEXPR20 bool refresh_on_size() const {
+    return refreshOnSize;
+  }
+  VIEW_WRAPPER_CONSTEXPR20 bool refresh_before_push_pop() const {
+    return refreshBeforePushPop;
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 void refresh(const C& v, size_type& idxBegin,
+                                        size_type& idxEnd) const {
+    if (wholeBounds) {
+      idxBegin = 0;
+      idxEnd = v.size();
+      return;
+    }
+#ifdef VIEW_WRAPPER_OPTIONAL_BOUNDS
+    if (!fBounds || !*fBounds) return;
+    auto p = (*fBounds)(v);
+#else
+    if (!fBounds) return;
+    auto p = fBounds(v);
+#endif
+    idxBegin = p.first;
+    idxEnd = p.second;
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 void grow(size_type) const {}
+  VIEW_WRAPPER_CONSTEXPR20 void shrink(size_type) const {}
+
+  // full container: dynamic bounds [0, size)
+  static VIEW_WRAPPER_CONSTEXPR20 basic_function_bounds whole() {
+    basic_function_bounds b;
+    b.wholeBounds = true;
+    b.refreshOnSize = true;
+    b.refreshBeforePushPop = true;
+    return b;
+  }
+};
+
+template <typename T, typename A = std::allocator<T>>
+using function_bounds = basic_function_bounds<std::vector<T, A>>;
+
 // What is the advantage of inheriting from:
 // std::ranges::view_interface<Subvector<T, A> ?
 // nothing special, just to make it 'more range' perhaps...
@@ -38,11 +241,14 @@ namespace view_wrapper {
 // class subvector : public std::ranges::view_interface<subvector<T, A>> {
 // #endif
 
-template <typename T, typename A = std::allocator<T>>
-class subvector {
+// Bounds policy B is privately inherited, so stateless policies take no space
+template <typename T, typename A = std::allocator<T>,
+          typename B = function_bounds<T, A>>
+class subvector : private B {
  public:
   using value_type = T;
   using allocator_type = A;
+  using bounds_type = B;
   using size_type = typename std::vector<T, A>::size_type;
   using iterator = typename std::vector<T, A>::iterator;
   using const_iterator = typename std::vector<T, A>::const_iterator;
@@ -50,49 +256,39 @@ class subvector {
  private:
   // immutable, but nullable
   std::vector<T, A>* remote{nullptr};
-  size_type idxBegin, idxEnd;
-  // cached bounds
-  // std::pair<size_type, size_type> bounds;
-  // dynamic bounds
-  using fBoundsType =
-      std::function<std::pair<size_type, size_type>(const std::vector<T, A>&)>;
-  fBoundsType fBounds;
-  // === refresh bounds strategies ===
-  // 0. must refresh on size() call
-  bool refreshOnSize{false};
-  // 1. must refresh before push/pop write operation
-  //   => middle iterator-based 'emplace', 'insert', 'erase', not included...
-  //      otherwise, they would be doubly executed on push_back, pop_front!
-  //      another reason is that users can manually invoke 'refresh' if needed!
-  bool refreshBeforePushPop{false};
+  size_type idxBegin{0}, idxEnd{0};
 
  public:
-  // full vector: dynamic bounds [0, size)
-  explicit subvector(std::vector<T, A>& _remote)
-      : remote{&_remote}, refreshOnSize{true}, refreshBeforePushPop{true} {
-    fBounds =
-        [](const std::vector<T, A>& vr) -> std::pair<size_type, size_type> {
-      return std::make_pair(0, vr.size());
-    };
+  // bounds policy (e.g., to inspect stateful policies)
+  VIEW_WRAPPER_CONSTEXPR20 const B& bounds() const { return *this; }
+
+  // full vector: dynamic bounds [0, size) (or fixed, for fixed_bounds)
+  VIEW_WRAPPER_CONSTEXPR20 explicit subvector(std::vector<T, A>& _remote)
+      : B{B::whole()},
+        remote{&_remote},
+        idxBegin{0},
+        idxEnd{_remote.size()} {
     // invoke dynamic bounds function
     refresh();
   }
 
   // fixed-range of vector in format [closed, open)
-  subvector(std::vector<T, A>& _remote, size_type _idxBegin, size_type _idxEnd)
+  VIEW_WRAPPER_CONSTEXPR20 subvector(std::vector<T, A>& _remote,
+                                     size_type _idxBegin, size_type _idxEnd)
       : remote{&_remote}, idxBegin{_idxBegin}, idxEnd{_idxEnd} {
     // assert(idxBegin >= 0);
     // assert(idxBegin <= idxEnd);
     // assert(idxEnd <= remote->size());
   }
 
-  // dynamic-range of vector
-  subvector(std::vector<T, A>& _remote, fBoundsType _fBounds,
-            bool _refreshOnSize = true, bool _refreshBeforePushPop = true)
-      : remote{&_remote},
-        fBounds{_fBounds},
-        refreshOnSize{_refreshOnSize},
-        refreshBeforePushPop{_refreshBeforePushPop} {
+  // dynamic-range of vector: arguments are forwarded to bounds policy B
+  // Example: subvector<int>(v, fBounds, refreshOnSize, refreshBeforePushPop)
+  template <typename F, typename... Flags,
+            typename = typename std::enable_if<
+                std::is_constructible<B, F&&, Flags...>::value>::type>
+  VIEW_WRAPPER_CONSTEXPR20 subvector(std::vector<T, A>& _remote, F&& _fBounds,
+                                     Flags... flags)
+      : B(std::forward<F>(_fBounds), flags...), remote{&_remote} {
     // invoke dynamic bounds function
     refresh();
     // assert(idxBegin >= 0);
@@ -100,97 +296,476 @@ class subvector {
     // assert(idxEnd <= remote->size());
   }
 
-  void refresh() const {
-    auto p = fBounds(*remote);
-    auto& thisConstless = const_cast<subvector<T, A>&>(*this);
-    thisConstless.idxBegin = p.first;
-    thisConstless.idxEnd = p.second;
+  VIEW_WRAPPER_CONSTEXPR20 void refresh() const {
+    VIEW_WRAPPER_COUNT(refresh, 1);
+    auto& thisConstless = const_cast<subvector<T, A, B>&>(*this);
+    bounds().refresh(*remote, thisConstless.idxBegin, thisConstless.idxEnd);
   }
 
 #if defined(__cpp_lib_span) && (__cpp_lib_span >= 202002L)
   // basic helper: can be removed if necessary...
-  std::span<T> as_span() {
+  VIEW_WRAPPER_CONSTEXPR20 std::span<T> as_span() {
     return std::span<T>{remote->begin() + idxBegin, remote->begin() + idxEnd};
   }
 #endif
 
-  std::vector<T, A> as_copy() {
+  // copy uses the allocator of remote vector (e.g., same arena)
+  VIEW_WRAPPER_CONSTEXPR20 std::vector<T, A> as_copy() {
+    return as_copy(remote->get_allocator());
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 std::vector<T, A> as_copy(const A& alloc) {
+    VIEW_WRAPPER_COUNT(as_copy, 1);
+    VIEW_WRAPPER_COUNT(bytes_copied, (idxEnd - idxBegin) * sizeof(T));
     return std::vector<T, A>(remote->begin() + idxBegin,
-                             remote->begin() + idxEnd);
+                             remote->begin() + idxEnd, alloc);
+  }
+
+  // copy into out, reusing its capacity (memcpy for trivially copyable T)
+  void copy_into(std::vector<T, A>& out) const {
+    detail::bulk_copy(remote->data() + idxBegin, idxEnd - idxBegin, out);
+  }
+
+  // copy to output iterator (e.g., raw pointer or std::back_inserter)
+  template <typename OutIt>
+  OutIt copy_into(OutIt out) const {
+    return detail::bulk_copy(remote->data() + idxBegin, idxEnd - idxBegin,
+                             out);
   }
 
   // slice subvector into [a,b)
-  subvector<T, A> slice(size_type a, size_type b) const {
-    if (refreshOnSize) refresh();  // just to be extra careful
-    subvector<T, A> v2(*remote, idxBegin + a, idxBegin + b);
+  VIEW_WRAPPER_CONSTEXPR20 subvector<T, A, typename B::slice_policy> slice(
+      size_type a, size_type b) const {
+    if (bounds().refresh_on_size()) refresh();  // just to be extra careful
+    VIEW_WRAPPER_COUNT(slice, 1);
+    subvector<T, A, typename B::slice_policy> v2(*remote, idxBegin + a,
+                                                 idxBegin + b);
     return v2;
   }
 
-  size_type size() const {
-    if (refreshOnSize) refresh();
+  VIEW_WRAPPER_CONSTEXPR20 size_type size() const {
+    if (bounds().refresh_on_size()) refresh();
     return idxEnd - idxBegin;
   }
-  bool empty() const { return size() == 0; }
+  VIEW_WRAPPER_CONSTEXPR20 bool empty() const { return size() == 0; }
 
-  T& operator[](size_type idx) { return *(remote->begin() + idxBegin + idx); }
+  VIEW_WRAPPER_CONSTEXPR20 T& operator[](size_type idx) {
+    return *(remote->begin() + idxBegin + idx);
+  }
 
-  const T& operator[](size_type idx) const {
+  VIEW_WRAPPER_CONSTEXPR20 const T& operator[](size_type idx) const {
     return *(remote->begin() + idxBegin + idx);
   }
 
   // implements iterators from view!!!
-  iterator begin() { return remote->begin() + idxBegin; }
-  iterator end() { return remote->begin() + idxEnd; }
-  const_iterator begin() const { return remote->begin() + idxBegin; }
-  const_iterator end() const { return remote->begin() + idxEnd; }
+  VIEW_WRAPPER_CONSTEXPR20 iterator begin() {
+    return remote->begin() + idxBegin;
+  }
+  VIEW_WRAPPER_CONSTEXPR20 iterator end() { return remote->begin() + idxEnd; }
+  VIEW_WRAPPER_CONSTEXPR20 const_iterator begin() const {
+    return remote->begin() + idxBegin;
+  }
+  VIEW_WRAPPER_CONSTEXPR20 const_iterator end() const {
+    return remote->begin() + idxEnd;
+  }
 
-  void push_back(T&& val) { emplace_back(std::move(val)); }
+  VIEW_WRAPPER_CONSTEXPR20 void push_back(T&& val) {
+    emplace_back(std::move(val));
+  }
 
-  void push_back(const T& val) { emplace_back(std::move(val)); }
+  VIEW_WRAPPER_CONSTEXPR20 void push_back(const T& val) {
+    emplace_back(std::move(val));
+  }
 
   template <typename... XArgs>
-  auto emplace_back(XArgs&&... args_build) {
-    if (refreshBeforePushPop) refresh();
+  VIEW_WRAPPER_CONSTEXPR20 auto emplace_back(XArgs&&... args_build) {
+    if (bounds().refresh_before_push_pop()) refresh();
+    VIEW_WRAPPER_COUNT_SHIFT(emplace, remote->size() - idxEnd, sizeof(T));
     auto it = remote->begin() + idxEnd;
     idxEnd++;
-    return remote->emplace(it, std::forward<XArgs>(args_build)...);
+    auto r = remote->emplace(it, std::forward<XArgs>(args_build)...);
+    bounds().grow(1);
+    return r;
   }
 
   template <typename... XArgs>
-  auto emplace(iterator it, XArgs&&... args_build) {
+  VIEW_WRAPPER_CONSTEXPR20 auto emplace(iterator it, XArgs&&... args_build) {
+    VIEW_WRAPPER_COUNT_SHIFT(emplace, remote->end() - it, sizeof(T));
     idxEnd++;
-    return remote->emplace(it, std::forward<XArgs>(args_build)...);
+    auto r = remote->emplace(it, std::forward<XArgs>(args_build)...);
+    bounds().grow(1);
+    return r;
   }
 
-  iterator insert(const_iterator pos, const T& value) {
+  VIEW_WRAPPER_CONSTEXPR20 iterator insert(const_iterator pos, const T& value) {
+    VIEW_WRAPPER_COUNT_SHIFT(insert, remote->cend() - pos, sizeof(T));
     idxEnd++;
-    return remote->insert(pos, value);
+    auto r = remote->insert(pos, value);
+    bounds().grow(1);
+    return r;
   }
 
-  auto erase(iterator it) noexcept {
+  VIEW_WRAPPER_CONSTEXPR20 auto erase(iterator it) noexcept {
+    VIEW_WRAPPER_COUNT_SHIFT(erase, remote->end() - it - 1, sizeof(T));
     idxEnd--;
+    bounds().shrink(1);
     return remote->erase(it);
   }
 
-  auto erase(iterator it_start, const iterator& it_end) noexcept {
+  VIEW_WRAPPER_CONSTEXPR20 auto erase(iterator it_start,
+                                      const iterator& it_end) noexcept {
+    VIEW_WRAPPER_COUNT_SHIFT(erase, remote->end() - it_end, sizeof(T));
     const size_t count = std::distance(it_start, it_end);
     idxEnd -= count;
+    bounds().shrink(count);
     return remote->erase(it_start, it_end);
   }
 
-  void pop_back() noexcept {
-    if (refreshBeforePushPop) refresh();
-    remote->erase(remote->begin() + idxEnd);
+  VIEW_WRAPPER_CONSTEXPR20 void pop_back() noexcept {
+    if (bounds().refresh_before_push_pop()) refresh();
+    VIEW_WRAPPER_COUNT_SHIFT(pop_back, remote->size() - idxEnd, sizeof(T));
     idxEnd--;
+    remote->erase(remote->begin() + idxEnd);
+    bounds().shrink(1);
+  }
+
+  // === bulk operations ===
+  // Each one moves the remote tail once (and reallocates at most once),
+  // instead of once per element as in a push_back/emplace loop.
+  // Source ranges must not refer to the same remote vector.
+
+  template <typename InputIt,
+            typename = typename std::enable_if<std::is_convertible<
+                typename std::iterator_traits<InputIt>::iterator_category,
+                std::input_iterator_tag>::value>::type>
+  VIEW_WRAPPER_CONSTEXPR20 iterator insert(const_iterator pos, InputIt first,
+                                           InputIt last) {
+    VIEW_WRAPPER_COUNT_SHIFT(insert, remote->cend() - pos, sizeof(T));
+    const size_type before = remote->size();
+    auto r = remote->insert(pos, first, last);
+    const size_type count = remote->size() - before;
+    idxEnd += count;
+    bounds().grow(count);
+    return r;
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 iterator insert(const_iterator pos, size_type count,
+                                           const T& value) {
+    VIEW_WRAPPER_COUNT_SHIFT(insert, remote->cend() - pos, sizeof(T));
+    auto r = remote->insert(pos, count, value);
+    idxEnd += count;
+    bounds().grow(count);
+    return r;
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 iterator insert(const_iterator pos,
+                                           std::initializer_list<T> ilist) {
+    return insert(pos, ilist.begin(), ilist.end());
+  }
+
+  // C++23-style insert_range and append_range (any range with begin/end)
+  template <typename R>
+  VIEW_WRAPPER_CONSTEXPR20 iterator insert_range(const_iterator pos, R&& rg) {
+    using std::begin;
+    using std::end;
+    return insert(pos, begin(rg), end(rg));
+  }
+
+  template <typename R>
+  VIEW_WRAPPER_CONSTEXPR20 void append_range(R&& rg) {
+    if (bounds().refresh_before_push_pop()) refresh();
+    insert_range(remote->cbegin() + idxEnd, std::forward<R>(rg));
+  }
+
+  // replaces contents: overwrites common prefix, then a single insert/erase
+  template <typename ForwardIt,
+            typename = typename std::enable_if<std::is_convertible<
+                typename std::iterator_traits<ForwardIt>::iterator_category,
+                std::forward_iterator_tag>::value>::type>
+  VIEW_WRAPPER_CONSTEXPR20 void assign(ForwardIt first, ForwardIt last) {
+    if (bounds().refresh_before_push_pop()) refresh();
+    const size_type count = std::distance(first, last);
+    const size_type common = std::min(count, idxEnd - idxBegin);
+    ForwardIt mid = first;
+    std::advance(mid, common);
+    auto it = std::copy(first, mid, remote->begin() + idxBegin);
+    if (count > common)
+      insert(it, mid, last);
+    else
+      erase(it, remote->begin() + idxEnd);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 void assign(size_type count, const T& value) {
+    if (bounds().refresh_before_push_pop()) refresh();
+    const size_type common = std::min(count, idxEnd - idxBegin);
+    auto it = std::fill_n(remote->begin() + idxBegin, common, value);
+    if (count > common)
+      insert(it, count - common, value);
+    else
+      erase(it, remote->begin() + idxEnd);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 void assign(std::initializer_list<T> ilist) {
+    assign(ilist.begin(), ilist.end());
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 void resize(size_type count) { resize(count, T()); }
+
+  VIEW_WRAPPER_CONSTEXPR20 void resize(size_type count, const T& value) {
+    if (bounds().refresh_before_push_pop()) refresh();
+    const size_type sz = idxEnd - idxBegin;
+    if (count > sz)
+      insert(remote->cbegin() + idxEnd, count - sz, value);
+    else if (count < sz)
+      erase(remote->begin() + idxBegin + count, remote->begin() + idxEnd);
+  }
+
+  // removes all elements satisfying pred, returns number of removed elements
+  template <typename Pred>
+  VIEW_WRAPPER_CONSTEXPR20 size_type erase_if(Pred pred) {
+    if (bounds().refresh_before_push_pop()) refresh();
+    auto last = remote->begin() + idxEnd;
+    auto it = std::remove_if(remote->begin() + idxBegin, last, pred);
+    const size_type count = std::distance(it, last);
+    erase(it, last);
+    return count;
   }
 
   // less important
 
-  T& back() noexcept { return operator[](size() - 1); }
+  VIEW_WRAPPER_CONSTEXPR20 T& back() noexcept { return operator[](size() - 1); }
 
   // TODO: cbegin, cend, rbegin, rend, crbegin, crend, ...
 };
 
+// same as std::erase_if for std::vector (C++20), found by ADL
+template <typename T, typename A, typename B, typename Pred>
+VIEW_WRAPPER_CONSTEXPR20 typename subvector<T, A, B>::size_type erase_if(
+    subvector<T, A, B>& sv, Pred pred) {
+  return sv.erase_if(pred);
+}
+
+// helper for user-defined lambda_bounds (no std::function type erasure)
+// Example: auto sv = make_subvector(v, [](const std::vector<int>& v) {...});
+template <typename T, typename A, typename F>
+VIEW_WRAPPER_CONSTEXPR20
+    subvector<T, A, lambda_bounds<typename std::decay<F>::type>>
+    make_subvector(std::vector<T, A>& _remote, F&& _fBounds) {
+  return subvector<T, A, lambda_bounds<typename std::decay<F>::type>>(
+      _remote, std::forward<F>(_fBounds));
+}
+
+// stateless policies take no space and copy with no heap allocation
+static_assert(sizeof(subvector<int, std::allocator<int>, full_bounds>) ==
+                  sizeof(std::vector<int>*) + 2 * sizeof(std::size_t),
+              "full_bounds subvector must only hold remote and indices");
+static_assert(std::is_trivially_copyable<
+                  subvector<int, std::allocator<int>, full_bounds>>::value,
+              "full_bounds subvector must be trivially copyable");
+
+// =================================================
+// fixed_subvector is a compact fixed-bounds subvector:
+// it only holds the remote pointer and [idxBegin, idxEnd) indices,
+// with 32-bit (default) or 64-bit index type.
+//
+// It is trivially copyable, so containers of fixed_subvector
+// reallocate with memcpy (no per-element std::function copy).
+// =================================================
+
+template <typename T, typename A = std::allocator<T>,
+          typename Index = std::uint32_t>
+class fixed_subvector {
+ public:
+  using value_type = T;
+  using allocator_type = A;
+  using index_type = Index;
+  using size_type = typename std::vector<T, A>::size_type;
+  using iterator = typename std::vector<T, A>::iterator;
+  using const_iterator = typename std::vector<T, A>::const_iterator;
+
+  static_assert(std::is_unsigned<Index>::value,
+                "fixed_subvector index type must be unsigned");
+
+ private:
+  // immutable, but nullable
+  std::vector<T, A>* remote{nullptr};
+  Index idxBegin{0}, idxEnd{0};
+
+  // narrows to Index, throwing instead of silently truncating
+  VIEW_WRAPPER_CONSTEXPR20 static Index to_index(size_type n) {
+    if (n > std::numeric_limits<Index>::max())
+      throw std::length_error("fixed_subvector: index exceeds Index range");
+    return Index(n);
+  }
+
+  // one more element must still fit in Index
+  VIEW_WRAPPER_CONSTEXPR20 void check_grow() const {
+    if (idxEnd == std::numeric_limits<Index>::max())
+      throw std::length_error("fixed_subvector: index exceeds Index range");
+  }
+
+ public:
+  // full vector, fixed at construction: [0, size)
+  VIEW_WRAPPER_CONSTEXPR20 explicit fixed_subvector(std::vector<T, A>& _remote)
+      : remote{&_remote}, idxBegin{0}, idxEnd{to_index(_remote.size())} {}
+
+  // fixed-range of vector in format [closed, open)
+  VIEW_WRAPPER_CONSTEXPR20 fixed_subvector(std::vector<T, A>& _remote,
+                                           size_type _idxBegin,
+                                           size_type _idxEnd)
+      : remote{&_remote},
+        idxBegin{to_index(_idxBegin)},
+        idxEnd{to_index(_idxEnd)} {
+    // assert(idxBegin <= idxEnd);
+    // assert(idxEnd <= remote->size());
+  }
+
+  // fixed bounds: nothing to refresh
+  VIEW_WRAPPER_CONSTEXPR20 void refresh() const {}
+
+#if defined(__cpp_lib_span) && (__cpp_lib_span >= 202002L)
+  VIEW_WRAPPER_CONSTEXPR20 std::span<T> as_span() {
+    return std::span<T>{remote->begin() + idxBegin, remote->begin() + idxEnd};
+  }
+#endif
+
+  // copy uses the allocator of remote vector (e.g., same arena)
+  VIEW_WRAPPER_CONSTEXPR20 std::vector<T, A> as_copy() {
+    return as_copy(remote->get_allocator());
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 std::vector<T, A> as_copy(const A& alloc) {
+    VIEW_WRAPPER_COUNT(as_copy, 1);
+    VIEW_WRAPPER_COUNT(bytes_copied, (idxEnd - idxBegin) * sizeof(T));
+    return std::vector<T, A>(remote->begin() + idxBegin,
+                             remote->begin() + idxEnd, alloc);
+  }
+
+  // copy into out, reusing its capacity (memcpy for trivially copyable T)
+  void copy_into(std::vector<T, A>& out) const {
+    detail::bulk_copy(remote->data() + idxBegin, idxEnd - idxBegin, out);
+  }
+
+  // copy to output iterator (e.g., raw pointer or std::back_inserter)
+  template <typename OutIt>
+  OutIt copy_into(OutIt out) const {
+    return detail::bulk_copy(remote->data() + idxBegin, idxEnd - idxBegin,
+                             out);
+  }
+
+  // slice fixed_subvector into [a,b)
+  VIEW_WRAPPER_CONSTEXPR20 fixed_subvector slice(size_type a,
+                                                 size_type b) const {
+    VIEW_WRAPPER_COUNT(slice, 1);
+    return fixed_subvector(*remote, idxBegin + a, idxBegin + b);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 size_type size() const { return idxEnd - idxBegin; }
+  VIEW_WRAPPER_CONSTEXPR20 bool empty() const { return idxEnd == idxBegin; }
+
+  VIEW_WRAPPER_CONSTEXPR20 T& operator[](size_type idx) {
+    return *(remote->begin() + idxBegin + idx);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 const T& operator[](size_type idx) const {
+    return *(remote->begin() + idxBegin + idx);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 iterator begin() {
+    return remote->begin() + idxBegin;
+  }
+  VIEW_WRAPPER_CONSTEXPR20 iterator end() { return remote->begin() + idxEnd; }
+  VIEW_WRAPPER_CONSTEXPR20 const_iterator begin() const {
+    return remote->begin() + idxBegin;
+  }
+  VIEW_WRAPPER_CONSTEXPR20 const_iterator end() const {
+    return remote->begin() + idxEnd;
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 void push_back(T&& val) {
+    emplace_back(std::move(val));
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 void push_back(const T& val) { emplace_back(val); }
+
+  template <typename... XArgs>
+  VIEW_WRAPPER_CONSTEXPR20 auto emplace_back(XArgs&&... args_build) {
+    check_grow();
+    VIEW_WRAPPER_COUNT_SHIFT(emplace, remote->size() - idxEnd, sizeof(T));
+    auto it = remote->begin() + idxEnd;
+    idxEnd++;
+    return remote->emplace(it, std::forward<XArgs>(args_build)...);
+  }
+
+  template <typename... XArgs>
+  VIEW_WRAPPER_CONSTEXPR20 auto emplace(iterator it, XArgs&&... args_build) {
+    check_grow();
+    VIEW_WRAPPER_COUNT_SHIFT(emplace, remote->end() - it, sizeof(T));
+    idxEnd++;
+    return remote->emplace(it, std::forward<XArgs>(args_build)...);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 iterator insert(const_iterator pos, const T& value) {
+    check_grow();
+    VIEW_WRAPPER_COUNT_SHIFT(insert, remote->cend() - pos, sizeof(T));
+    idxEnd++;
+    return remote->insert(pos, value);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 auto erase(iterator it) noexcept {
+    VIEW_WRAPPER_COUNT_SHIFT(erase, remote->end() - it - 1, sizeof(T));
+    idxEnd--;
+    return remote->erase(it);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 auto erase(iterator it_start,
+                                      const iterator& it_end) noexcept {
+    VIEW_WRAPPER_COUNT_SHIFT(erase, remote->end() - it_end, sizeof(T));
+    idxEnd -= Index(std::distance(it_start, it_end));
+    return remote->erase(it_start, it_end);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 void pop_back() noexcept {
+    VIEW_WRAPPER_COUNT_SHIFT(pop_back, remote->size() - idxEnd, sizeof(T));
+    idxEnd--;
+    remote->erase(remote->begin() + idxEnd);
+  }
+
+  VIEW_WRAPPER_CONSTEXPR20 T& back() noexcept { return operator[](size() - 1); }
+};
+
+static_assert(sizeof(fixed_subvector<int>) ==
+                  sizeof(std::vector<int>*) + 2 * sizeof(std::uint32_t),
+              "fixed_subvector must only hold remote and 32-bit indices");
+static_assert(sizeof(fixed_subvector<int, std::allocator<int>,
+                                     std::uint64_t>) ==
+                  sizeof(std::vector<int>*) + 2 * sizeof(std::uint64_t),
+              "fixed_subvector must only hold remote and 64-bit indices");
+static_assert(std::is_trivially_copyable<fixed_subvector<int>>::value,
+              "fixed_subvector must be trivially copyable");
+
+}  // namespace view_wrapper
+
+// subvector and fixed_subvector are borrowed views: iterators point into the
+// remote vector and copies are O(1), so std::views pipelines hold them by
+// value (no ref_view/owning_view), and iterators may outlive a temporary
+#if defined(__cpp_lib_ranges) && (__cpp_lib_ranges >= 201911L)
+template <typename T, typename A, typename B>
+inline constexpr bool
+    std::ranges::enable_borrowed_range<view_wrapper::subvector<T, A, B>> = true;
+template <typename T, typename A, typename B>
+inline constexpr bool
+    std::ranges::enable_view<view_wrapper::subvector<T, A, B>> = true;
+template <typename T, typename A, typename Index>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    view_wrapper::fixed_subvector<T, A, Index>> = true;
+template <typename T, typename A, typename Index>
+inline constexpr bool
+    std::ranges::enable_view<view_wrapper::fixed_subvector<T, A, Index>> = true;
+#endif
+
+namespace view_wrapper {
+
 // Check if C++20 Concepts is supported
 #if defined(__cpp_concepts) && (__cpp_concepts >= 201907L)
 static_assert(std::movable<subvector<int>>);
@@ -199,6 +774,23 @@ static_assert(std::ranges::contiguous_range<subvector<int>>);
 static_assert(std::ranges::sized_range<subvector<int>>);
 static_assert(std::ranges::random_access_range<subvector<int>>);
 static_assert(std::ranges::viewable_range<subvector<int>>);
+static_assert(std::copyable<subvector<int, std::allocator<int>, full_bounds>>);
+static_assert(std::ranges::contiguous_range<
+              subvector<int, std::allocator<int>, fixed_bounds>>);
+static_assert(std::copyable<fixed_subvector<int>>);
+static_assert(std::ranges::contiguous_range<fixed_subvector<int>>);
+static_assert(std::ranges::sized_range<fixed_subvector<int>>);
+static_assert(std::ranges::viewable_range<fixed_subvector<int>>);
+#endif
+
+#if defined(__cpp_lib_ranges) && (__cpp_lib_ranges >= 201911L)
+static_assert(std::ranges::view<subvector<int>>);
+static_assert(std::ranges::borrowed_range<subvector<int>>);
+static_assert(std::ranges::view<fixed_subvector<int>>);
+static_assert(std::ranges::borrowed_range<fixed_subvector<int>>);
+// pipelines store the subvector itself (views::all is the identity)
+static_assert(std::is_same<std::views::all_t<subvector<int>&>,
+                           subvector<int>>::value);
 #endif
 
 }  // namespace view_wrapper
@@ -0,0 +1,181 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_TRACKED_VECTOR_HPP_
+#define VIEW_WRAPPER_TRACKED_VECTOR_HPP_
+
+// tracked_vector is a C++14 vector wrapper that bumps a generation counter
+// on every mutation, so dynamic subvector bounds (tracked_bounds) are only
+// recomputed when the remote vector actually changed.
+//
+// Note that writes to element values through subvector or iterators are
+// not tracked: if bounds depend on values (e.g., std::find), call touch().
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+//
+#include "./subvector.hpp"
+
+namespace view_wrapper {
+
+template <typename T, typename A>
+class tracked_vector;
+
+// dynamic bounds F(remote), cached until remote generation changes
+template <typename T, typename A, typename F>
+class tracked_bounds {
+ public:
+  using size_type = typename std::vector<T, A>::size_type;
+  using slice_policy = fixed_bounds;
+
+ private:
+  tracked_vector<T, A>* tracker{nullptr};
+  F fBounds;
+  // generation of cached bounds
+  mutable bool cached{false};
+  mutable std::size_t generation{0};
+  // counters
+  mutable std::size_t refreshCount{0};
+  mutable std::size_t skipCount{0};
+
+ public:
+  tracked_bounds(tracked_vector<T, A>* _tracker, F _fBounds)
+      : tracker{_tracker}, fBounds{std::move(_fBounds)} {}
+
+  static constexpr bool refresh_on_size() { return true; }
+  static constexpr bool refresh_before_push_pop() { return true; }
+
+  void refresh(const std::vector<T, A>& v, size_type& idxBegin,
+               size_type& idxEnd) const {
+    if (cached && (generation == tracker->generation())) {
+      skipCount++;
+      return;
+    }
+    auto p = fBounds(v);
+    idxBegin = p.first;
+    idxEnd = p.second;
+    cached = true;
+    generation = tracker->generation();
+    refreshCount++;
+  }
+
+  // own writes also invalidate every sibling (including itself)
+  void grow(size_type) const { tracker->touch(); }
+  void shrink(size_type) const { tracker->touch(); }
+
+  // number of fBounds invocations
+  std::size_t refresh_count() const { return refreshCount; }
+  // number of refresh() calls answered from cache
+  std::size_t skip_count() const { return skipCount; }
+};
+
+template <typename T, typename A = std::allocator<T>>
+class tracked_vector {
+ public:
+  using value_type = T;
+  using allocator_type = A;
+  using size_type = typename std::vector<T, A>::size_type;
+  using iterator = typename std::vector<T, A>::iterator;
+  using const_iterator = typename std::vector<T, A>::const_iterator;
+
+ private:
+  std::vector<T, A> remote;
+  std::size_t gen{0};
+
+ public:
+  tracked_vector() = default;
+
+  explicit tracked_vector(std::vector<T, A> _remote)
+      : remote{std::move(_remote)} {}
+
+  tracked_vector(std::initializer_list<T> ilist) : remote(ilist) {}
+
+  tracked_vector(const tracked_vector&) = delete;
+  tracked_vector& operator=(const tracked_vector&) = delete;
+
+  std::size_t generation() const { return gen; }
+
+  // manually invalidates all cached bounds
+  void touch() { ++gen; }
+
+  // subvector with dynamic bounds F(remote), cached by generation
+  template <typename F>
+  subvector<T, A, tracked_bounds<T, A, F>> track(F fBounds) {
+    return subvector<T, A, tracked_bounds<T, A, F>>(
+        remote, tracked_bounds<T, A, F>(this, std::move(fBounds)));
+  }
+
+  // read-only access
+  const std::vector<T, A>& as_vector() const { return remote; }
+
+  // escape hatch: invalidates and gives write access to the vector
+  std::vector<T, A>& modify() {
+    touch();
+    return remote;
+  }
+
+  size_type size() const { return remote.size(); }
+  bool empty() const { return remote.empty(); }
+
+  const T& operator[](size_type idx) const { return remote[idx]; }
+
+  const_iterator begin() const { return remote.begin(); }
+  const_iterator end() const { return remote.end(); }
+
+  // === tracked mutations ===
+
+  // element write access (value may affect bounds)
+  T& at(size_type idx) {
+    touch();
+    return remote.at(idx);
+  }
+
+  void push_back(const T& val) { emplace_back(val); }
+
+  void push_back(T&& val) { emplace_back(std::move(val)); }
+
+  template <typename... XArgs>
+  T& emplace_back(XArgs&&... args_build) {
+    touch();
+    remote.emplace_back(std::forward<XArgs>(args_build)...);
+    return remote.back();
+  }
+
+  void pop_back() {
+    touch();
+    remote.pop_back();
+  }
+
+  template <typename... XArgs>
+  iterator insert(const_iterator pos, XArgs&&... args) {
+    touch();
+    return remote.insert(pos, std::forward<XArgs>(args)...);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    touch();
+    return remote.erase(first, last);
+  }
+
+  iterator erase(const_iterator pos) {
+    touch();
+    return remote.erase(pos);
+  }
+
+  void resize(size_type count) {
+    touch();
+    remote.resize(count);
+  }
+
+  void clear() {
+    touch();
+    remote.clear();
+  }
+};
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_TRACKED_VECTOR_HPP_
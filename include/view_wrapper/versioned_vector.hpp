@@ -0,0 +1,286 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifndef VIEW_WRAPPER_VERSIONED_VECTOR_HPP_
+#define VIEW_WRAPPER_VERSIONED_VECTOR_HPP_
+
+// versioned_vector<X> is a C++20 single-writer, multi-reader vector with
+// copy-on-publish versions: the writer mutates a private working vector
+// and publish()es it, while readers take immutable snapshots that stay
+// valid (even if the writer reallocates) until the snapshot is dropped:
+//
+//   versioned_vector<int> vv;
+//   // writer thread:
+//   vv.edit().push_back(1);
+//   vv.publish();
+//   // reader threads (never wait for edit() or publish() copies):
+//   auto snap = vv.snapshot();
+//   for (int x : *snap) sum += x;   // std::span<const int>, no overhead
+//
+// snapshot() is lock-free: it loads the current version (a raw atomic
+// pointer), pins it with a hazard pointer and takes a reference, so it
+// never waits for the writer or for other readers (std::atomic of
+// std::shared_ptr is not lock-free in libstdc++). With a cached snapshot,
+// it is one atomic version load (snapshot(cached) reloads only when stale);
+// element access is a plain std::span.
+//
+// Each publish() copies the working vector into a version buffer. Buffers
+// of released versions are reused by the next publish(), so a steady-state
+// publish() does not allocate.
+//
+// edit(), publish() and update() must only be called by a single writer.
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+//
+#include "./View.hpp"
+
+namespace view_wrapper {
+
+namespace detail {
+
+// per-thread starting slot for hazard pointer claims (spreads readers)
+inline std::size_t hazard_hint() {
+  static std::atomic<std::size_t> next{0};
+  thread_local std::size_t hint = next.fetch_add(1);
+  return hint;
+}
+
+}  // namespace detail
+
+template <typename X, typename A = std::allocator<X>>
+class versioned_vector {
+ public:
+  using value_type = std::vector<X, A>;
+  using size_type = typename value_type::size_type;
+
+ private:
+  struct version_data {
+    value_type items;
+    std::uint64_t version{0};
+    // snapshots + 1 while owned by the versioned_vector
+    std::atomic<std::size_t> refs{1};
+  };
+
+  static void release(version_data* p) {
+    if (p && p->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete p;
+  }
+
+  // hazard pointers: a reader publishes the version it is about to
+  // reference, so publish() does not reuse that buffer meanwhile
+  struct hazard_chunk {
+    static constexpr std::size_t size = 64;
+    std::atomic<version_data*> slots[size] = {};
+    std::atomic<hazard_chunk*> next{nullptr};
+  };
+
+  value_type working;
+  std::uint64_t nextVersion{0};
+  std::atomic<version_data*> current{nullptr};
+  // version of current (cheap staleness check for cached snapshots)
+  std::atomic<std::uint64_t> published{0};
+  mutable hazard_chunk hazards;
+  // writer only: replaced versions (maybe still referenced)
+  std::vector<version_data*> retired;
+  std::vector<version_data*> pinned;
+
+  // claims a free hazard slot holding p (adds a chunk if all are busy)
+  std::atomic<version_data*>& claim_hazard(version_data* p) const {
+    const std::size_t hint = detail::hazard_hint();
+    for (hazard_chunk* c = &hazards; c;
+         c = c->next.load(std::memory_order_acquire)) {
+      for (std::size_t k = 0; k < hazard_chunk::size; k++) {
+        auto& h = c->slots[(hint + k) % hazard_chunk::size];
+        version_data* expected = nullptr;
+        if (!h.load(std::memory_order_relaxed) &&
+            h.compare_exchange_strong(expected, p))
+          return h;
+      }
+    }
+    auto* c = new hazard_chunk;
+    c->slots[0].store(p, std::memory_order_relaxed);
+    // new chunks go right after the first one
+    hazard_chunk* head = hazards.next.load(std::memory_order_relaxed);
+    do {
+      c->next.store(head, std::memory_order_relaxed);
+    } while (!hazards.next.compare_exchange_weak(head, c));
+    return c->slots[0];
+  }
+
+  // a retired buffer no reader references (nullptr if none)
+  version_data* take_free_buffer() {
+    if (retired.empty()) return nullptr;
+    // hazards first, then refs: a reader that cleared its hazard after
+    // scanning has already taken its reference
+    pinned.clear();
+    for (hazard_chunk* c = &hazards; c; c = c->next.load())
+      for (auto& h : c->slots)
+        if (version_data* p = h.load()) pinned.push_back(p);
+    version_data* found = nullptr;
+    for (std::size_t i = 0; i < retired.size();) {
+      version_data* p = retired[i];
+      bool busy = p->refs.load(std::memory_order_acquire) != 1 ||
+                  std::find(pinned.begin(), pinned.end(), p) != pinned.end();
+      if (busy) {
+        i++;
+        continue;
+      }
+      retired[i] = retired.back();
+      retired.pop_back();
+      if (found)
+        delete p;  // reuse one, free the others
+      else
+        found = p;
+    }
+    return found;
+  }
+
+ public:
+  // immutable version of the vector (satisfies IsView); keeps its buffer
+  // alive, so it stays valid while the writer keeps mutating
+  class snapshot_type {
+   private:
+    version_data* data{nullptr};
+    std::span<const X> sv;
+
+    friend class versioned_vector;
+
+    // adopts one reference to _data
+    explicit snapshot_type(version_data* _data)
+        : data{_data}, sv{data->items} {}
+
+   public:
+    using value_type = std::vector<X, A>;
+    using view_type = std::span<const X>;
+
+    snapshot_type() = default;
+
+    snapshot_type(const snapshot_type& other) : data{other.data}, sv{other.sv} {
+      if (data) data->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    snapshot_type(snapshot_type&& other) noexcept
+        : data{std::exchange(other.data, nullptr)},
+          sv{std::exchange(other.sv, {})} {}
+
+    snapshot_type& operator=(snapshot_type other) noexcept {
+      std::swap(data, other.data);
+      std::swap(sv, other.sv);
+      return *this;
+    }
+
+    ~snapshot_type() { release(data); }
+
+    bool has_value() const { return data != nullptr; }
+    std::uint64_t version() const { return data->version; }
+
+    const std::span<const X>& as_view() const { return sv; }
+
+    std::vector<X, A> as_copy() const { return data->items; }
+
+    std::vector<X, A> as_copy(const A& alloc) const {
+      return std::vector<X, A>(sv.begin(), sv.end(), alloc);
+    }
+
+    void copy_into(std::vector<X, A>& out) const {
+      detail::bulk_copy(sv.data(), sv.size(), out);
+    }
+
+    template <typename OutIt>
+    OutIt copy_into(OutIt out) const {
+      return detail::bulk_copy(sv.data(), sv.size(), out);
+    }
+
+    size_type size() const { return sv.size(); }
+    bool empty() const { return sv.empty(); }
+    const X& operator[](size_type idx) const { return sv[idx]; }
+    auto begin() const { return sv.begin(); }
+    auto end() const { return sv.end(); }
+
+    const std::span<const X>& operator*() const { return sv; }
+    const std::span<const X>* operator->() const { return &sv; }
+  };
+
+  versioned_vector() : versioned_vector(value_type{}) {}
+
+  explicit versioned_vector(value_type initial) : working{std::move(initial)} {
+    publish();
+  }
+
+  versioned_vector(const versioned_vector&) = delete;
+  versioned_vector& operator=(const versioned_vector&) = delete;
+
+  // versions still referenced by snapshots are freed by their last one
+  ~versioned_vector() {
+    release(current.load());
+    for (version_data* p : retired) release(p);
+    for (hazard_chunk* c = hazards.next.load(); c;) {
+      hazard_chunk* next = c->next.load();
+      delete c;
+      c = next;
+    }
+  }
+
+  // === readers (any thread) ===
+
+  snapshot_type snapshot() const {
+    version_data* p = current.load();
+    auto& h = claim_hazard(p);
+    // validate: p is still current once the hazard is visible
+    for (version_data* q; (q = current.load()) != p; p = q) h.store(q);
+    p->refs.fetch_add(1, std::memory_order_relaxed);
+    h.store(nullptr, std::memory_order_release);
+    return snapshot_type(p);
+  }
+
+  // refreshes a cached snapshot only if stale (one atomic load when not),
+  // e.g., for a long-lived reader thread
+  const snapshot_type& snapshot(snapshot_type& cached) const {
+    if (!cached.has_value() ||
+        cached.version() != published.load(std::memory_order_acquire))
+      cached = snapshot();
+    return cached;
+  }
+
+  // version number of latest publish() (0 is the initial contents)
+  std::uint64_t version() const {
+    return published.load(std::memory_order_acquire);
+  }
+
+  // === single writer ===
+
+  // working vector, not visible to readers until publish()
+  value_type& edit() { return working; }
+
+  // publishes a copy of working vector as a new version
+  std::uint64_t publish() {
+    version_data* buf = take_free_buffer();
+    if (buf)
+      buf->items = working;  // reuses buffer capacity
+    else
+      buf = new version_data{working, 0};
+    buf->version = nextVersion++;
+    if (version_data* old = current.exchange(buf)) retired.push_back(old);
+    published.store(buf->version, std::memory_order_release);
+    return buf->version;
+  }
+
+  // f(working), then publish()
+  template <typename F>
+  std::uint64_t update(F&& f) {
+    std::forward<F>(f)(working);
+    return publish();
+  }
+};
+
+static_assert(IsView<versioned_vector<int>::snapshot_type>);
+
+}  // namespace view_wrapper
+
+#endif  // VIEW_WRAPPER_VERSIONED_VECTOR_HPP_
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+//
+#include <view_wrapper/Range.hpp>
+#include <view_wrapper/View.hpp>
+#include <view_wrapper/arena.hpp>
+#include <view_wrapper/subvector.hpp>
+
+using view_wrapper::arena_allocator;
+using view_wrapper::bump_arena;
+using view_wrapper::IsRange;
+using view_wrapper::IsView;
+using view_wrapper::pool_allocator;
+using view_wrapper::pool_arena;
+using view_wrapper::Range;
+using view_wrapper::subvector;
+using view_wrapper::View;
+
+static_assert(IsView<View<std::pmr::vector<int>>>);
+static_assert(IsView<View<std::vector<int, arena_allocator<int>>>>);
+static_assert(IsRange<Range<std::pmr::vector<int>>>);
+static_assert(IsRange<Range<std::vector<int, pool_allocator<int>>>>);
+
+TEST_CASE("bump_arena allocates aligned memory and resets") {
+  bump_arena arena(64);
+  void* p1 = arena.allocate(3, 1);
+  void* p2 = arena.allocate(8, 8);
+  REQUIRE(reinterpret_cast<std::uintptr_t>(p2) % 8 == 0);
+  REQUIRE(p1 != p2);
+  // larger than a block
+  void* p3 = arena.allocate(1000, 16);
+  REQUIRE(reinterpret_cast<std::uintptr_t>(p3) % 16 == 0);
+  REQUIRE(arena.bytes_used() == 1011);
+  const std::size_t cap = arena.capacity();
+  arena.reset();
+  REQUIRE(arena.bytes_used() == 0);
+  // blocks are reused after reset
+  REQUIRE(arena.allocate(3, 1) == p1);
+  arena.allocate(1000, 16);
+  REQUIRE(arena.capacity() == cap);
+}
+
+TEST_CASE("subvector and Range over arena-backed vector") {
+  bump_arena arena;
+  using alloc = arena_allocator<int>;
+  std::vector<int, alloc> v({1, 2, 3, 4, 5}, alloc(arena));
+  subvector<int, alloc> sv(v, 1, 4);
+  sv.push_back(10);
+  sv.insert(sv.begin(), {7, 8});
+  REQUIRE(v == std::vector<int, alloc>({1, 7, 8, 2, 3, 4, 10, 5}, alloc()));
+  // copy stays in remote arena
+  auto copy = sv.as_copy();
+  REQUIRE(copy.get_allocator().resource() == &arena);
+  REQUIRE(copy.size() == 6);
+  // explicit allocator (global heap)
+  REQUIRE(sv.as_copy(alloc()).get_allocator().resource() == nullptr);
+
+  Range<std::vector<int, alloc>> r(v);
+  REQUIRE(r.as_copy().get_allocator().resource() == &arena);
+  REQUIRE(r.as_copy().size() == 8);
+
+  View<std::vector<int, alloc>> view(v);
+  REQUIRE(view.as_copy(alloc(arena)) == v);
+  REQUIRE(view->size() == 8);
+}
+
+TEST_CASE("pool_arena reuses released blocks") {
+  pool_arena pool;
+  using alloc = pool_allocator<std::string>;
+  const int* first = nullptr;
+  {
+    std::vector<int, pool_allocator<int>> v(100, 1,
+                                            pool_allocator<int>(pool));
+    first = v.data();
+  }
+  std::vector<int, pool_allocator<int>> v2(90, 2, pool_allocator<int>(pool));
+  REQUIRE(v2.data() == first);
+
+  std::vector<std::string, alloc> names(alloc{pool});
+  subvector<std::string, alloc> sv(names);
+  for (int i = 0; i < 100; i++) sv.push_back(std::to_string(i));
+  REQUIRE(names.size() == 100);
+  REQUIRE(names[42] == "42");
+  // large requests use global heap
+  std::vector<char, pool_allocator<char>> big(1 << 20, 'x',
+                                              pool_allocator<char>(pool));
+  REQUIRE(big.back() == 'x');
+}
+
+struct alignas(64) cache_line {
+  int value;
+};
+
+TEST_CASE("over-aligned types through pool_arena and the global heap") {
+  pool_arena pool;
+  using alloc = pool_allocator<cache_line>;
+  std::vector<std::vector<cache_line, alloc>> pooled;
+  std::vector<std::vector<cache_line, alloc>> heap;  // no arena
+  for (int i = 1; i <= 32; i++) {
+    pooled.emplace_back(i, cache_line{i}, alloc(pool));
+    heap.emplace_back(i, cache_line{i});
+  }
+  for (const auto& v : pooled)
+    REQUIRE(reinterpret_cast<std::uintptr_t>(v.data()) % 64 == 0);
+  for (const auto& v : heap)
+    REQUIRE(reinterpret_cast<std::uintptr_t>(v.data()) % 64 == 0);
+  REQUIRE(pooled[31][31].value == 32);
+}
+
+TEST_CASE("std::pmr::vector works with Range, View and subvector") {
+  std::pmr::monotonic_buffer_resource mbr;
+  std::pmr::vector<int> v({1, 2, 3, 4}, &mbr);
+  subvector<int, std::pmr::polymorphic_allocator<int>> sv(v, 1, 3);
+  sv.push_back(9);
+  REQUIRE(sv.as_copy().get_allocator().resource() == &mbr);
+  Range<std::pmr::vector<int>> r(v);
+  REQUIRE(r.as_copy() == std::pmr::vector<int>({1, 2, 3, 9, 4}));
+  View<std::pmr::vector<int>> view(v);
+  REQUIRE(view.as_copy().size() == 5);
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <sstream>
+#include <string>
+#include <vector>
+//
+#include <view_wrapper/chunked_reader.hpp>
+
+using view_wrapper::chunked_reader;
+
+namespace {
+// concatenates windows, checking each one ends on a record boundary
+std::string read_all(const std::string& input, std::size_t chunk,
+                     bool prefetch, std::size_t* windows = nullptr) {
+  std::istringstream in(input);
+  chunked_reader reader(in, chunk, '\n', prefetch);
+  std::string out;
+  std::size_t count = 0;
+  for (auto w : reader) {
+    std::string s = w.as_copy();
+    bool last = (out.size() + s.size() == input.size());
+    if (!last) CHECK(s.back() == '\n');
+    out += s;
+    count++;
+  }
+  if (windows) *windows = count;
+  return out;
+}
+}  // namespace
+
+TEST_CASE("chunked_reader windows hold complete records") {
+  std::string input;
+  for (int i = 0; i < 200; i++) input += "record-" + std::to_string(i) + "\n";
+  for (std::size_t chunk : {8, 13, 64, 1000, 100000}) {
+    REQUIRE(read_all(input, chunk, false) == input);
+    REQUIRE(read_all(input, chunk, true) == input);
+  }
+  std::size_t windows = 0;
+  read_all(input, 100000, false, &windows);
+  REQUIRE(windows == 1);
+}
+
+TEST_CASE("chunked_reader stitches records larger than a chunk") {
+  std::string input = "a\n" + std::string(100, 'x') + "\nb\n" +
+                      std::string(37, 'y') + "\nlast-without-newline";
+  REQUIRE(read_all(input, 4, false) == input);
+  REQUIRE(read_all(input, 4, true) == input);
+}
+
+TEST_CASE("chunked_reader as IsView and empty input") {
+  std::istringstream in("x,y,z");
+  chunked_reader reader(in, 2, ',');
+  std::vector<std::string> windows;
+  while (reader.next()) windows.push_back(reader.as_copy());
+  REQUIRE(windows == std::vector<std::string>{"x,", "y,", "z"});
+  REQUIRE(reader.done());
+  REQUIRE(reader.as_view().empty());
+
+  std::istringstream empty("");
+  chunked_reader r2(empty, 16);
+  REQUIRE(r2.begin() == r2.end());
+}
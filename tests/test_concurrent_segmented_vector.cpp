@@ -0,0 +1,81 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+//
+#include <view_wrapper/concurrent_segmented_vector.hpp>
+
+using view_wrapper::concurrent_segmented_vector;
+
+TEST_CASE("concurrent_segmented_vector single appender") {
+  concurrent_segmented_vector<int> out(10, 4);
+  REQUIRE(out.capacity() == 10);
+  {
+    auto app = out.appender();
+    for (int i = 0; i < 6; i++) app.push_back(i);
+    // current (second) block holds 4 and 5
+    std::span<int> blk = app.block();
+    REQUIRE(blk.size() == 2);
+    REQUIRE(blk[0] == 4);
+    blk[1] = 50;  // in place, no shifts of shared storage
+  }
+  REQUIRE(out.num_blocks() == 2);
+  REQUIRE(out.size() == 6);
+  REQUIRE(out.segment(1).size() == 2);
+  auto dense = out.compact();
+  REQUIRE(dense == std::vector<int>({0, 1, 2, 3, 4, 50}));
+}
+
+TEST_CASE("concurrent_segmented_vector offset table and compact with gaps") {
+  concurrent_segmented_vector<int> out(12, 4);
+  {
+    auto a = out.appender();
+    auto b = out.appender();
+    a.push_back(1);   // block 0
+    b.push_back(10);  // block 1
+    b.push_back(11);
+    a.push_back(2);
+  }
+  auto table = out.ranges();
+  REQUIRE(table.size() == 2);
+  REQUIRE(table[0] == std::make_pair(std::size_t(0), std::size_t(2)));
+  REQUIRE(table[1] == std::make_pair(std::size_t(4), std::size_t(6)));
+  REQUIRE(out.compact() == std::vector<int>({1, 2, 10, 11}));
+}
+
+TEST_CASE("concurrent_segmented_vector capacity exhaustion") {
+  concurrent_segmented_vector<int> out(5, 2);
+  auto app = out.appender();
+  for (int i = 0; i < 5; i++) REQUIRE(app.try_push_back(i));
+  REQUIRE(!app.try_push_back(5));
+  REQUIRE_THROWS_AS(app.push_back(5), std::length_error);
+}
+
+TEST_CASE("concurrent_segmented_vector multi-producer appends") {
+  const int threads = 4;
+  const int per_thread = 10000;
+  concurrent_segmented_vector<int> out(threads * per_thread + 1024, 256);
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; t++)
+    pool.emplace_back([&out, t] {
+      auto app = out.appender();
+      for (int i = 0; i < per_thread; i++) app.push_back(t * per_thread + i);
+    });
+  for (auto& th : pool) th.join();
+
+  REQUIRE(out.size() == threads * per_thread);
+  auto dense = out.compact();
+  REQUIRE(dense.size() == threads * per_thread);
+  std::sort(dense.begin(), dense.end());
+  for (int i = 0; i < threads * per_thread; i++) REQUIRE(dense[i] == i);
+}
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// C++20 constant evaluation: every check below is a static_assert, so this
+// file fails to compile (not to run) if any member loses constexpr
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <string>
+#include <vector>
+//
+#include <view_wrapper/Range.hpp>
+#include <view_wrapper/View.hpp>
+#include <view_wrapper/substring.hpp>
+#include <view_wrapper/subvector.hpp>
+
+using view_wrapper::fixed_bounds;
+using view_wrapper::fixed_subvector;
+using view_wrapper::full_bounds;
+using view_wrapper::Range;
+using view_wrapper::StableView;
+using view_wrapper::substring;
+using view_wrapper::subvector;
+using view_wrapper::View;
+
+// compile-time lookup table (e.g., squares)
+constexpr std::vector<int> squares(int n) {
+  std::vector<int> v;
+  for (int i = 0; i < n; i++) v.push_back(i * i);
+  return v;
+}
+
+template <typename S>
+constexpr int sum(const S& s) {
+  int total = 0;
+  for (int x : s) total += x;
+  return total;
+}
+
+// default policy: whole() and fixed ranges (no std::function)
+constexpr bool default_bounds() {
+  std::vector<int> v = squares(5);  // 0 1 4 9 16
+  subvector<int> all(v);
+  subvector<int> mid(v, 1, 4);
+  if (all.size() != 5 || mid.size() != 3) return false;
+  if (sum(mid) != 14 || mid[0] != 1) return false;
+  // whole() bounds follow the remote vector
+  v.push_back(25);
+  if (all.size() != 6) return false;
+  // copies (and assignment) of default policy
+  subvector<int> mid2 = mid;
+  mid2 = all;
+  return mid2.size() == 6;
+}
+static_assert(default_bounds());
+
+constexpr bool slice_and_copy() {
+  std::vector<int> v = squares(6);  // 0 1 4 9 16 25
+  subvector<int, std::allocator<int>, fixed_bounds> sv(v, 1, 5);
+  auto s = sv.slice(1, 3);  // 4 9
+  std::vector<int> c = s.as_copy();
+  return s.size() == 2 && c.size() == 2 && c[0] == 4 && c[1] == 9 &&
+         sum(sv) == 30;
+}
+static_assert(slice_and_copy());
+
+constexpr bool push_back_and_insert() {
+  std::vector<int> v = {1, 2, 3, 10};
+  subvector<int, std::allocator<int>, fixed_bounds> sv(v, 0, 3);
+  sv.push_back(4);            // 1 2 3 4 | 10
+  sv.insert(sv.begin(), 0);   // 0 1 2 3 4 | 10
+  sv.insert(sv.end(), 2, 5);  // 0 1 2 3 4 5 5 | 10
+  sv.erase(sv.begin());
+  sv.pop_back();  // 1 2 3 4 5 | 10
+  return sv.size() == 5 && v.size() == 6 && sum(sv) == 15 && v.back() == 10;
+}
+static_assert(push_back_and_insert());
+
+constexpr bool full_bounds_policy() {
+  std::vector<int> v = squares(3);
+  subvector<int, std::allocator<int>, full_bounds> sv(v);
+  sv.push_back(9);
+  v.push_back(16);
+  return sv.size() == 5 && sum(sv) == 30;
+}
+static_assert(full_bounds_policy());
+
+constexpr bool fixed_subvector_ops() {
+  std::vector<int> v = squares(5);
+  fixed_subvector<int> fs(v, 1, 3);  // 1 4
+  fs.push_back(7);                   // 1 4 7 | 9 16
+  auto s = fs.slice(1, 3);
+  std::vector<int> c = s.as_copy();
+  return fs.size() == 3 && c.size() == 2 && c[1] == 7 && v[3] == 7;
+}
+static_assert(fixed_subvector_ops());
+
+constexpr bool views() {
+  std::vector<int> v = squares(4);  // 0 1 4 9
+  View<std::vector<int>> vw(v);
+  StableView<std::vector<int>> st(v, 1, 3);  // 1 4
+  std::vector<int> c = vw.as_copy();
+  bool ok = vw.has_value() && c.size() == 4 && sum(st) == 5;
+  v.push_back(16);  // may reallocate: StableView still valid
+  return ok && st[1] == 4 && st.as_copy().size() == 2;
+}
+static_assert(views());
+
+constexpr bool string_views() {
+  std::string s = "constexpr";
+  View<std::string> vw(s);
+  return vw.as_copy() == "constexpr" && vw->size() == 9;
+}
+static_assert(string_views());
+
+constexpr bool ranges() {
+  std::vector<int> v = squares(4);
+  Range<std::vector<int>> r(v);
+  std::vector<int> c = r.as_copy();
+  r->push_back(16);
+  return c.size() == 4 && r->size() == 5 && sum(r) == 30;
+}
+static_assert(ranges());
+
+constexpr bool substrings() {
+  std::string page = "Hello, {{name}}!";
+  substring field(page, 7, 15);
+  field.replace(0, field.size(), "World");
+  Range<std::string> r(page);
+  return page == "Hello, World!" && r.as_copy() == page &&
+         field.as_copy() == "World";
+}
+static_assert(substrings());
+
+TEST_CASE("constexpr subvector, View and Range (static_assert)") {
+  // all checks are static_assert above: reaching here means they passed
+  STATIC_REQUIRE(default_bounds());
+  STATIC_REQUIRE(ranges());
+}
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// counters enabled for this translation unit
+#define VIEW_WRAPPER_INSTRUMENT
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+//
+#include <view_wrapper/Range.hpp>
+#include <view_wrapper/View.hpp>
+#include <view_wrapper/instrumentation.hpp>
+#include <view_wrapper/subvector.hpp>
+
+using view_wrapper::subvector;
+using fixed_bounds_subvector =
+    subvector<int, std::allocator<int>, view_wrapper::fixed_bounds>;
+using view_wrapper::instrument::counter;
+
+TEST_CASE("instrumentation counts subvector tail shifts") {
+  STATIC_REQUIRE(view_wrapper::instrument::enabled);
+  view_wrapper::instrument::reset();
+  std::vector<int> v = {1, 2, 3, 4, 5, 6};
+  subvector<int> sv(v, 0, 2);
+  sv.push_back(10);      // shifts 4 elements
+  sv.erase(sv.begin());  // shifts 6 elements
+  sv.pop_back();         // shifts 4 elements
+  auto s = view_wrapper::instrument::snapshot();
+  REQUIRE(s[counter::emplace] == 1);
+  REQUIRE(s[counter::erase] == 1);
+  REQUIRE(s[counter::pop_back] == 1);
+  REQUIRE(s[counter::elements_moved] == 14);
+  REQUIRE(s[counter::bytes_shifted] == 14 * sizeof(int));
+}
+
+TEST_CASE("instrumentation counts refresh, slice and as_copy") {
+  view_wrapper::instrument::reset();
+  std::vector<int> v = {1, 2, 3, 4};
+  subvector<int> whole(v);     // refresh on construction
+  REQUIRE(whole.size() == 4);  // refresh on size
+  auto part = whole.slice(1, 3);
+  auto copy = part.as_copy();
+  view_wrapper::View<std::vector<int>> view(v);
+  view.as_copy();
+  std::string str = "abc";
+  view_wrapper::View<std::string> sview(str);
+  sview.as_copy();
+  auto s = view_wrapper::instrument::snapshot();
+  REQUIRE(s[counter::refresh] >= 2);
+  REQUIRE(s[counter::slice] == 1);
+  REQUIRE(s[counter::as_copy] == 3);
+  REQUIRE(s[counter::bytes_copied] == 2 * sizeof(int) + 4 * sizeof(int) + 3);
+}
+
+TEST_CASE("instrumentation aggregates per-thread counters") {
+  view_wrapper::instrument::reset();
+  std::vector<std::thread> pool;
+  for (int t = 0; t < 4; t++)
+    pool.emplace_back([] {
+      std::vector<int> v;
+      fixed_bounds_subvector sv(v, 0, 0);
+      for (int i = 0; i < 100; i++) sv.push_back(i);
+    });
+  for (auto& th : pool) th.join();
+  // counts of finished threads are kept
+  auto s = view_wrapper::instrument::snapshot();
+  REQUIRE(s[counter::emplace] == 400);
+  REQUIRE(s[counter::elements_moved] == 0);
+  std::string json = s.to_json();
+  REQUIRE(json.find("\"emplace\": 400") != std::string::npos);
+  REQUIRE(json.front() == '{');
+  REQUIRE(json.back() == '}');
+}
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+// counters disabled (default): VIEW_WRAPPER_INSTRUMENT is not defined
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <vector>
+//
+#include <view_wrapper/View.hpp>
+#include <view_wrapper/instrumentation.hpp>
+#include <view_wrapper/subvector.hpp>
+
+using view_wrapper::subvector;
+using view_wrapper::instrument::counter;
+
+static int evaluated = 0;
+
+[[maybe_unused]] static int side_effect() { return ++evaluated; }
+
+TEST_CASE("instrumentation compiles out when disabled") {
+  STATIC_REQUIRE(!view_wrapper::instrument::enabled);
+  // arguments of disabled counters are not even evaluated
+  VIEW_WRAPPER_COUNT(refresh, side_effect());
+  VIEW_WRAPPER_COUNT_SHIFT(erase, side_effect(), side_effect());
+  REQUIRE(evaluated == 0);
+
+  // instrumented operations leave no counts (no thread counters created)
+  std::vector<int> v = {1, 2, 3};
+  subvector<int> sv(v);
+  sv.push_back(4);
+  sv.erase(sv.begin());
+  sv.slice(0, 1).as_copy();
+  view_wrapper::View<std::vector<int>>(v).as_copy();
+  auto s = view_wrapper::instrument::snapshot();
+  for (std::size_t i = 0; i < view_wrapper::instrument::num_counters; i++)
+    REQUIRE(s.values[i] == 0);
+  REQUIRE(view_wrapper::instrument::detail::get_registry().live.empty());
+}
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <ranges>
+#include <string>
+#include <system_error>
+#include <vector>
+//
+#include <unistd.h>
+//
+#include <view_wrapper/mapped_file.hpp>
+
+using view_wrapper::access_hint;
+using view_wrapper::mapped_array;
+using view_wrapper::mapped_file;
+using view_wrapper::View;
+
+namespace {
+// unique file (mkstemp), so parallel test runs do not collide
+std::string write_temp(const std::string& name, const std::string& content) {
+  auto path = (std::filesystem::temp_directory_path() / name).string();
+  path += ".XXXXXX";
+  int fd = ::mkstemp(path.data());
+  if (fd >= 0) ::close(fd);
+  std::ofstream out(path, std::ios::binary);
+  out.write(content.data(), static_cast<std::streamsize>(content.size()));
+  return path;
+}
+}  // namespace
+
+TEST_CASE("View<mapped_file> views file contents without copy") {
+  std::string path = write_temp("vw_test_mapped.txt", "hello\nmapped world");
+  mapped_file f(path, access_hint::sequential);
+  REQUIRE(f.size() == 18);
+  View<mapped_file> v(f);
+  REQUIRE(v.has_value());
+  REQUIRE(v.as_view() == "hello\nmapped world");
+  REQUIRE(v->data() == f.data());
+  REQUIRE(v.as_copy() == "hello\nmapped world");
+  // std::views pipelines over the mapping (no copy)
+  auto word = v | std::views::drop(6) | std::views::take(6);
+  REQUIRE(std::string(word.begin(), word.end()) == "mapped");
+  f.advise(access_hint::random);
+
+  // move keeps mapping (and views) valid
+  mapped_file f2 = std::move(f);
+  REQUIRE(f.empty());
+  REQUIRE(v.as_view() == "hello\nmapped world");
+  REQUIRE(f2.data() == v->data());
+  std::remove(path.c_str());
+}
+
+TEST_CASE("empty and missing files") {
+  std::string path = write_temp("vw_test_empty.txt", "");
+  mapped_file f(path);
+  REQUIRE(f.empty());
+  View<mapped_file> v(f);
+  REQUIRE_FALSE(v.has_value());
+  REQUIRE(v.as_copy().empty());
+  std::remove(path.c_str());
+
+  bool thrown = false;
+  try {
+    mapped_file missing("/nonexistent/view_wrapper/file");
+  } catch (const std::system_error& e) {
+    thrown = true;
+    REQUIRE(e.code() == std::errc::no_such_file_or_directory);
+  }
+  REQUIRE(thrown);
+}
+
+TEST_CASE("View<mapped_array<T>> views binary data as span") {
+  std::vector<std::int32_t> data = {1, -2, 3, 40000, 5};
+  std::string bytes(reinterpret_cast<const char*>(data.data()),
+                    data.size() * sizeof(std::int32_t));
+  bytes += "xy";  // trailing partial element is ignored
+  std::string path = write_temp("vw_test_array.bin", bytes);
+  mapped_array<std::int32_t> a(path);
+  REQUIRE(a.size() == 5);
+  REQUIRE(a[3] == 40000);
+  View<mapped_array<std::int32_t>> v(a);
+  REQUIRE(v->size() == 5);
+  REQUIRE(v.as_copy() == data);
+  REQUIRE(std::ranges::count_if(v, [](std::int32_t x) { return x > 0; }) == 4);
+  std::remove(path.c_str());
+}
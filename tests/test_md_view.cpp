@@ -0,0 +1,117 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+//
+#include <view_wrapper/View.hpp>
+#include <view_wrapper/md_view.hpp>
+#include <view_wrapper/subvector.hpp>
+
+using view_wrapper::md_layout;
+using view_wrapper::md_view;
+using view_wrapper::subvector;
+using view_wrapper::View;
+
+TEST_CASE("md_view row-major and column-major indexing") {
+  std::vector<int> v(12);
+  std::iota(v.begin(), v.end(), 0);
+  md_view<int, 2> m(v, {3, 4});
+  REQUIRE(m.size() == 12);
+  REQUIRE(m(0, 0) == 0);
+  REQUIRE(m(1, 2) == 6);
+  REQUIRE(m(2, 3) == 11);
+  REQUIRE(m.is_contiguous());
+
+  md_view<int, 2> c(v, {3, 4}, md_layout::col_major);
+  REQUIRE(c(1, 2) == 7);
+  REQUIRE(c.stride(0) == 1);
+  REQUIRE(c.stride(1) == 3);
+  REQUIRE_FALSE(c.is_contiguous());
+  REQUIRE(m.as_span().size() == 12);
+  bool thrown = false;
+  try {
+    c.as_span();  // column-major: flat span would be in the wrong order
+  } catch (const std::logic_error&) {
+    thrown = true;
+  }
+  REQUIRE(thrown);
+
+  md_view<int, 3> t(v, {2, 3, 2});
+  REQUIRE(t(1, 2, 1) == 11);
+  REQUIRE(t(1, 0, 1) == 7);
+}
+
+TEST_CASE("md_view row, col and submatrix are zero-copy") {
+  std::vector<float> v(20, 0.0f);
+  View<std::vector<float>> view(v);
+  md_view<float, 2> m(view, {4, 5});
+  auto r = m.row(2);
+  std::fill(r.begin(), r.end(), 1.0f);
+  REQUIRE(v[10] == 1.0f);
+  REQUIRE(v[14] == 1.0f);
+  auto c = m.col(3);
+  REQUIRE(c.extent(0) == 4);
+  for (auto& x : c) x += 2.0f;
+  REQUIRE(v[3] == 2.0f);
+  REQUIRE(v[13] == 3.0f);
+  REQUIRE(c[2] == 3.0f);
+  REQUIRE(std::ranges::count(c, 2.0f) == 3);
+
+  auto s = m.submatrix(1, 1, 2, 3);
+  REQUIRE(s.extent(0) == 2);
+  REQUIRE(s.extent(1) == 3);
+  s(1, 2) = 9.0f;
+  REQUIRE(m(2, 3) == 9.0f);
+  REQUIRE(s.row(1)[2] == 9.0f);
+  REQUIRE(m.transposed()(3, 2) == 9.0f);
+}
+
+TEST_CASE("md_view strided iterators stay inside storage") {
+  std::vector<int> v(12);
+  std::iota(v.begin(), v.end(), 0);
+  md_view<int, 2> m(v, {3, 4});
+  // last column: end() would be past the storage as a pointer
+  auto c = m.col(3);
+  REQUIRE(c.end() - c.begin() == 3);
+  REQUIRE(std::vector<int>(c.begin(), c.end()) == std::vector<int>({3, 7, 11}));
+  REQUIRE(*(c.end() - 1) == 11);
+  // zero stride (broadcast): distances still count elements
+  md_view<int, 1> b(v.data() + 5, {4}, {0});
+  REQUIRE(b.end() - b.begin() == 4);
+  REQUIRE(std::ranges::count(b, 5) == 4);
+}
+
+TEST_CASE("md_view tiled traversal visits every element once") {
+  std::vector<int> v(7 * 5, 0);
+  subvector<int> sv(v);
+  md_view<int, 2> m(sv, {7, 5});
+  std::vector<std::pair<int, int>> order;
+  m.for_each_tiled(3, 2, [&](std::size_t i, std::size_t j, int& x) {
+    x++;
+    order.emplace_back(int(i), int(j));
+  });
+  REQUIRE(std::ranges::all_of(v, [](int x) { return x == 1; }));
+  // first tile is rows [0,3) x cols [0,2)
+  REQUIRE(order[0] == std::make_pair(0, 0));
+  REQUIRE(order[1] == std::make_pair(0, 1));
+  REQUIRE(order[2] == std::make_pair(1, 0));
+  REQUIRE(order[6] == std::make_pair(0, 2));
+
+  int tiles = 0;
+  std::size_t total = 0;
+  m.for_each_tile(3, 2, [&](md_view<int, 2> tile) {
+    tiles++;
+    total += tile.size();
+  });
+  REQUIRE(tiles == 9);
+  REQUIRE(total == 35);
+}
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+//
+#include <view_wrapper/Range.hpp>
+#include <view_wrapper/parallel.hpp>
+#include <view_wrapper/subvector.hpp>
+
+using view_wrapper::parallel_for_each;
+using view_wrapper::parallel_reduce;
+using view_wrapper::parallel_sort;
+using view_wrapper::parallel_transform;
+using view_wrapper::Range;
+using view_wrapper::subvector;
+using view_wrapper::thread_pool;
+
+TEST_CASE("parallel_for_each visits every element of subvector") {
+  thread_pool pool(4);
+  std::vector<int> v(10000, 1);
+  subvector<int> sv(v, 100, 9900);
+  parallel_for_each(sv, [](int& x) { x *= 2; }, 64, pool);
+  REQUIRE(v[99] == 1);
+  REQUIRE(v[100] == 2);
+  REQUIRE(v[9899] == 2);
+  REQUIRE(v[9900] == 1);
+  REQUIRE(std::accumulate(v.begin(), v.end(), 0) == 10000 + 9800);
+}
+
+TEST_CASE("parallel_transform writes into output subvector") {
+  thread_pool pool(3);
+  std::vector<int> in(5000);
+  std::iota(in.begin(), in.end(), 0);
+  std::vector<std::int64_t> out(5000, -1);
+  subvector<int> sin(in);
+  subvector<std::int64_t> sout(out);
+  parallel_transform(sin, sout, [](int x) { return std::int64_t(x) * x; }, 100,
+                     pool);
+  for (int i = 0; i < 5000; i++) REQUIRE(out[i] == std::int64_t(i) * i);
+}
+
+TEST_CASE("parallel_reduce matches std::accumulate") {
+  thread_pool pool(4);
+  std::vector<int> v(12345);
+  std::iota(v.begin(), v.end(), 1);
+  subvector<int> sv(v);
+  REQUIRE(parallel_reduce(sv, std::int64_t{0}, std::plus<>{}, 100, pool) ==
+          std::int64_t(12345) * 12346 / 2);
+  auto mx = [](int a, int b) { return std::max(a, b); };
+  REQUIRE(parallel_reduce(sv, 0, mx, 7, pool) == 12345);
+  // empty and single-grain ranges
+  REQUIRE(parallel_reduce(sv.slice(3, 3), 0, std::plus<>{}, 10, pool) == 0);
+  REQUIRE(parallel_reduce(sv.slice(0, 4), 0, std::plus<>{}, 10, pool) == 10);
+}
+
+TEST_CASE("parallel_reduce combines a non-identity init once") {
+  thread_pool pool(4);
+  std::vector<long> v(100000, 1);
+  subvector<long> sv(v);
+  REQUIRE(parallel_reduce(sv, 10L, std::plus<>{}, 1000, pool) ==
+          std::reduce(v.begin(), v.end(), 10L));
+  REQUIRE(parallel_reduce(sv.slice(0, 0), 10L, std::plus<>{}, 1000, pool) ==
+          10);
+  // init of another type than the elements
+  REQUIRE(parallel_reduce(sv, 0.5, std::plus<>{}, 7, pool) == 100000.5);
+}
+
+TEST_CASE("parallel_sort sorts subvector only") {
+  thread_pool pool(4);
+  std::vector<int> v(20000);
+  for (int i = 0; i < 20000; i++) v[i] = (i * 7919) % 20000;
+  std::vector<int> expected = v;
+  std::sort(expected.begin() + 10, expected.end() - 10);
+  subvector<int> sv(v, 10, 19990);
+  parallel_sort(sv, std::less<>{}, 256, pool);
+  REQUIRE(v == expected);
+  parallel_sort(sv, std::greater<>{}, 256, pool);
+  REQUIRE(std::is_sorted(v.begin() + 10, v.end() - 10, std::greater<>{}));
+}
+
+TEST_CASE("parallel algorithms accept Range<std::vector<X>>") {
+  thread_pool pool(2);
+  std::vector<int> v = {5, 3, 1, 4, 2, 9, 8, 7, 6, 0};
+  Range<std::vector<int>> r(v);
+  parallel_sort(r, std::less<>{}, 2, pool);
+  REQUIRE(std::is_sorted(v.begin(), v.end()));
+  REQUIRE(parallel_reduce(r, 0, std::plus<>{}, 2, pool) == 45);
+}
+
+TEST_CASE("parallel exceptions are rethrown on caller") {
+  thread_pool pool(2);
+  std::vector<int> v(1000, 0);
+  v[777] = 1;
+  subvector<int> sv(v);
+  auto f = [](int x) {
+    if (x == 1) throw std::runtime_error("bad");
+  };
+  bool thrown = false;
+  try {
+    parallel_for_each(sv, f, 10, pool);
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  REQUIRE(thrown);
+  // pool still usable after an exception
+  REQUIRE(parallel_reduce(sv, 0, std::plus<>{}, 10, pool) == 1);
+}
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <vector>
+//
+#include <view_wrapper/partitioned_vector.hpp>
+
+using view_wrapper::partitioned_vector;
+
+TEST_CASE("partitioned_vector segments shift sibling bounds") {
+  partitioned_vector<int> pv({1, 2, -1, 4, 5, 6}, {2, 1, 3});
+  REQUIRE(pv.num_segments() == 3);
+  auto s0 = pv.segment(0);
+  auto s1 = pv.segment(1);
+  auto s2 = pv.segment(2);
+  REQUIRE(s0.size() == 2);
+  REQUIRE(s1.size() == 1);
+  REQUIRE(s2.size() == 3);
+  REQUIRE(s1[0] == -1);
+
+  s0.push_back(3);
+  REQUIRE(pv.size() == 7);
+  REQUIRE(s0.size() == 3);
+  REQUIRE(s0[2] == 3);
+  REQUIRE(s1.size() == 1);
+  REQUIRE(s1[0] == -1);
+  REQUIRE(s2.size() == 3);
+  REQUIRE(s2[0] == 4);
+
+  s1.insert(s1.begin(), 0);
+  REQUIRE(s1.size() == 2);
+  REQUIRE(s2.size() == 3);  // size() refreshes bounds
+  REQUIRE(s2[0] == 4);
+  REQUIRE(pv.offset(2) == 5);
+
+  s0.erase(s0.begin());
+  s2.pop_back();
+  REQUIRE(pv.as_vector() == std::vector<int>({2, 3, 0, -1, 4, 5}));
+  REQUIRE(s0.size() == 2);
+  REQUIRE(s1.size() == 2);
+  REQUIRE(s1[0] == 0);
+  REQUIRE(s2.size() == 2);
+  REQUIRE(s2[1] == 5);
+}
+
+TEST_CASE("partitioned_vector starts with empty segments") {
+  partitioned_vector<int> pv(5);
+  for (int i = 0; i < 5; i++) pv.segment(4 - i).push_back(i);
+  REQUIRE(pv.as_vector() == std::vector<int>({4, 3, 2, 1, 0}));
+  for (int i = 0; i < 5; i++) REQUIRE(pv.segment_size(i) == 1);
+  auto s3 = pv.segment(3);
+  s3.push_back(10);
+  REQUIRE(pv.segment(4)[0] == 0);
+  REQUIRE(pv.offset(5) == 6);
+}
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <ranges>
+#include <vector>
+//
+#include <view_wrapper/Range.hpp>
+#include <view_wrapper/View.hpp>
+#include <view_wrapper/simd.hpp>
+#include <view_wrapper/subvector.hpp>
+
+namespace simd = view_wrapper::simd;
+using view_wrapper::Range;
+using view_wrapper::subvector;
+using view_wrapper::View;
+
+namespace {
+
+const simd::isa all_isa[] = {simd::isa::scalar, simd::isa::sse2,
+                             simd::isa::avx2, simd::isa::avx512};
+
+template <typename T>
+std::vector<T> make_data(std::size_t n) {
+  std::vector<T> v(n);
+  for (std::size_t i = 0; i < n; i++) v[i] = T(int((i * 37 + 11) % 101) - 50);
+  return v;
+}
+
+}  // namespace
+
+TEST_CASE("simd int kernels match std::ranges on all lengths and isa") {
+  for (auto level : all_isa) {
+    for (std::size_t n = 1; n < 80; n++) {
+      auto v = make_data<std::int32_t>(n);
+      View<std::vector<std::int32_t>> vv(v);
+      REQUIRE(simd::sum(vv, level) == std::accumulate(v.begin(), v.end(), 0));
+      REQUIRE(simd::min(vv, level) == std::ranges::min(v));
+      REQUIRE(simd::max(vv, level) == std::ranges::max(v));
+      REQUIRE(simd::count(vv, 7, level) ==
+              std::size_t(std::ranges::count(v, 7)));
+      REQUIRE(simd::find(vv, v.back(), level) ==
+              std::size_t(std::ranges::find(v, v.back()) - v.begin()));
+      REQUIRE(simd::find(vv, 1000, level) == n);
+      auto w = v;
+      REQUIRE(simd::equal(v, w, level));
+      w[n / 2] += 1;
+      REQUIRE_FALSE(simd::equal(v, w, level));
+    }
+  }
+}
+
+TEST_CASE("simd float kernels match std::ranges on all lengths and isa") {
+  for (auto level : all_isa) {
+    for (std::size_t n = 1; n < 80; n++) {
+      auto v = make_data<float>(n);
+      View<std::vector<float>> vv(v);
+      float expected = std::accumulate(v.begin(), v.end(), 0.0f);
+      REQUIRE(std::fabs(simd::sum(vv, level) - expected) < 1e-3f);
+      REQUIRE(simd::min(vv, level) == std::ranges::min(v));
+      REQUIRE(simd::max(vv, level) == std::ranges::max(v));
+      REQUIRE(simd::count(vv, 7.0f, level) ==
+              std::size_t(std::ranges::count(v, 7.0f)));
+      REQUIRE(simd::find(vv, v.back(), level) ==
+              std::size_t(std::ranges::find(v, v.back()) - v.begin()));
+      auto w = v;
+      REQUIRE(simd::equal(v, w, level));
+      w[0] = -1000.0f;
+      REQUIRE_FALSE(simd::equal(v, w, level));
+    }
+  }
+}
+
+TEST_CASE("simd accepts subvector and Range") {
+  std::vector<int> v = make_data<int>(100);
+  subvector<int> sv(v, 10, 90);
+  auto expected = std::accumulate(v.begin() + 10, v.begin() + 90, 0);
+  REQUIRE(simd::sum(sv) == expected);
+  Range<std::vector<int>> rv(v);
+  REQUIRE(simd::sum(rv) == std::accumulate(v.begin(), v.end(), 0));
+  REQUIRE(simd::max(sv) == *std::max_element(v.begin() + 10, v.begin() + 90));
+  // scalar fallback for other element types
+  std::vector<double> d = {1.0, 2.0, 3.0};
+  REQUIRE(simd::sum(d) == 6.0);
+  REQUIRE(simd::find(d, 3.0) == 2);
+}
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <string>
+#include <vector>
+//
+#include <view_wrapper/slack_vector.hpp>
+
+using view_wrapper::slack_vector;
+
+TEST_CASE("slack_vector interleaved segment appends") {
+  slack_vector<int> sv(3);
+  for (int i = 0; i < 10; i++)
+    for (int s = 0; s < 3; s++) sv.segment(s).push_back(s * 100 + i);
+  REQUIRE(sv.size() == 30);
+  for (int s = 0; s < 3; s++) {
+    auto seg = sv.segment(s);
+    REQUIRE(seg.size() == 10);
+    REQUIRE(seg.capacity() >= 10);
+    for (int i = 0; i < 10; i++) REQUIRE(seg[i] == s * 100 + i);
+  }
+  auto sl = sv.segment(1).slice(2, 4);
+  REQUIRE(sl.size() == 2);
+  REQUIRE(sl[0] == 102);
+
+  sv.segment(0).pop_back();
+  REQUIRE(sv.size() == 29);
+  auto dense = sv.as_copy();
+  REQUIRE(dense.size() == 29);
+  REQUIRE(dense[9] == 100);
+
+  int sum = 0;
+  sv.for_each([&sum](int x) { sum += x; });
+  int expected = 0;
+  for (int x : dense) expected += x;
+  REQUIRE(sum == expected);
+
+  sv.shrink_to_fit();
+  REQUIRE(sv.segment_capacity(0) == 9);
+  REQUIRE(sv.as_copy() == dense);
+  sv.segment(2).push_back(-1);
+  REQUIRE(sv.segment(2).back() == -1);
+  REQUIRE(sv.segment(1)[9] == 109);
+}
+
+TEST_CASE("slack_vector with initial slack and non-trivial type") {
+  slack_vector<std::string> sv(2, 4);
+  REQUIRE(sv.segment_capacity(1) == 4);
+  sv.segment(1).emplace_back(3, 'x');
+  sv.segment(0).push_back("a");
+  REQUIRE(sv.segment(1)[0] == "xxx");
+  REQUIRE(sv.segment(0).as_copy() == std::vector<std::string>({"a"}));
+}
+
+TEST_CASE("slack_vector push_back of own element while growing") {
+  slack_vector<std::string> sv(2);
+  auto seg = sv.segment(0);
+  seg.push_back(std::string(40, 'a'));  // no SSO: heap-owned content
+  int growths = 0;
+  for (int i = 0; i < 40; i++) {
+    growths += (seg.size() == seg.capacity());
+    seg.push_back((i % 2) ? seg[0] : seg.back());
+    sv.segment(1).push_back("b");
+  }
+  REQUIRE(growths >= 4);
+  REQUIRE(seg.size() == 41);
+  for (const auto& s : seg) REQUIRE(s == std::string(40, 'a'));
+}
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+//
+#include <view_wrapper/sorted_subvector.hpp>
+
+using view_wrapper::sorted_subvector;
+
+TEST_CASE("sorted_subvector sorts its slice and keeps the rest") {
+  std::vector<int> v = {9, 1, 5, 100, 50};
+  sorted_subvector<int> seg(v, 0, 3);
+  REQUIRE(v == std::vector<int>({1, 5, 9, 100, 50}));
+  seg.insert(7);
+  seg.insert(0);
+  seg.insert(10);
+  REQUIRE(v == std::vector<int>({0, 1, 5, 7, 9, 10, 100, 50}));
+  REQUIRE(seg.size() == 6);
+  REQUIRE(std::is_sorted(seg.begin(), seg.end()));
+}
+
+TEST_CASE("sorted_subvector lookups") {
+  std::vector<int> v = {1, 3, 3, 3, 7, 9};
+  sorted_subvector<int> seg(v);
+  REQUIRE(seg.find(3) == seg.begin() + 1);
+  REQUIRE(seg.find(4) == seg.end());
+  REQUIRE(seg.contains(9));
+  REQUIRE(!seg.contains(10));
+  REQUIRE(seg.count(3) == 3);
+  auto r = seg.equal_range(3);
+  REQUIRE(r.first - seg.begin() == 1);
+  REQUIRE(r.second - seg.begin() == 4);
+  REQUIRE(seg.lower_bound(0) == seg.begin());
+  REQUIRE(seg.upper_bound(9) == seg.end());
+  REQUIRE(seg.erase(3) == 3);
+  REQUIRE(v == std::vector<int>({1, 7, 9}));
+  seg.erase(seg.find(7));
+  REQUIRE(v == std::vector<int>({1, 9}));
+}
+
+TEST_CASE("sorted_subvector merges a batch with one tail move") {
+  std::vector<int> v = {2, 4, 6, -1, -2};
+  sorted_subvector<int> seg(v, 0, 3);
+  std::vector<int> batch = {1, 5, 7};
+  seg.merge(batch);
+  REQUIRE(v == std::vector<int>({1, 2, 4, 5, 6, 7, -1, -2}));
+  // unsorted batch is sorted first
+  seg.merge(std::vector<int>{8, 3, 0});
+  REQUIRE(seg.size() == 9);
+  REQUIRE(std::is_sorted(seg.begin(), seg.end()));
+  REQUIRE(v[9] == -1);
+}
+
+TEST_CASE("sorted_subvector custom comparator") {
+  std::vector<std::string> v = {"b", "c", "a"};
+  sorted_subvector<std::string, std::greater<std::string>> seg(v);
+  REQUIRE(v == std::vector<std::string>({"c", "b", "a"}));
+  seg.insert(std::string("d"));
+  REQUIRE(v.front() == "d");
+  REQUIRE(seg.find("a") == seg.end() - 1);
+}
+
+TEST_CASE("sorted_subvector Eytzinger index matches binary search") {
+  for (int n : {0, 1, 2, 3, 7, 8, 100, 1000}) {
+    std::vector<int> v;
+    for (int i = 0; i < n; i++) v.push_back((i * 7919) % (n + 1) / 2 * 2);
+    v.push_back(-5);  // outside of slice
+    sorted_subvector<int> seg(v, 0, n);
+    std::vector<int> lo, up;
+    for (int key = -2; key <= n + 2; key++) {
+      lo.push_back(int(seg.lower_bound(key) - seg.begin()));
+      up.push_back(int(seg.upper_bound(key) - seg.begin()));
+    }
+    seg.build_index();
+    REQUIRE(seg.has_index() == (n > 0));
+    for (int key = -2; key <= n + 2; key++) {
+      REQUIRE(seg.lower_bound(key) - seg.begin() == lo[key + 2]);
+      REQUIRE(seg.upper_bound(key) - seg.begin() == up[key + 2]);
+    }
+    // edits drop the index
+    seg.insert(1);
+    REQUIRE(!seg.has_index());
+    REQUIRE(v.back() == -5);
+  }
+}
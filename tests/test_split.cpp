@@ -0,0 +1,84 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <string>
+#include <string_view>
+#include <vector>
+//
+#include <view_wrapper/View.hpp>
+#include <view_wrapper/split.hpp>
+
+using view_wrapper::split;
+using view_wrapper::split_mode;
+using view_wrapper::View;
+
+namespace {
+
+std::vector<std::string_view> fields(std::string& s, std::string_view delims,
+                                     split_mode mode = split_mode::plain) {
+  std::vector<std::string_view> out;
+  for (auto f : split(View<std::string>(s), delims, mode))
+    out.push_back(f.as_view());
+  return out;
+}
+
+}  // namespace
+
+TEST_CASE("split plain fields without copies") {
+  std::string s = "a,bb,,ccc,";
+  auto f = fields(s, ",");
+  REQUIRE(f == std::vector<std::string_view>({"a", "bb", "", "ccc", ""}));
+  // fields point into the original string
+  REQUIRE(f[1].data() == s.data() + 2);
+
+  std::string empty;
+  REQUIRE(fields(empty, ",").size() == 1);
+
+  // long lines cross SIMD blocks
+  std::string longline(100, 'x');
+  longline[40] = ';';
+  longline[70] = '\t';
+  auto lf = fields(longline, ";\t");
+  REQUIRE(lf.size() == 3);
+  REQUIRE(lf[0].size() == 40);
+  REQUIRE(lf[1].size() == 29);
+  REQUIRE(lf[2].size() == 29);
+}
+
+TEST_CASE("split with more delimiters than max_delims") {
+  // 21 delimiters, including a non-ASCII byte
+  std::string delims = "!#$%&*+-./:;<=>?@^|\xff";
+  REQUIRE(delims.size() > view_wrapper::split_view::max_delims);
+  std::string s = "a!b\xff" "c|d~e";
+  REQUIRE(fields(s, delims) ==
+          std::vector<std::string_view>({"a", "b", "c", "d~e"}));
+  auto sp = split(View<std::string>(s), delims);
+  auto it = sp.begin();
+  ++it;
+  REQUIRE(it.delimiter() == '\xff');
+
+  // just above max_delims
+  std::string few = "a b,c;d\te";
+  REQUIRE(fields(few, " ,;\t:") ==
+          std::vector<std::string_view>({"a", "b", "c", "d", "e"}));
+}
+
+TEST_CASE("split csv mode with quoted fields") {
+  std::string s = "x,\"a,b\",\"say \"\"hi\"\"\"\n1,2";
+  auto f = fields(s, ",\n", split_mode::csv);
+  REQUIRE(f == std::vector<std::string_view>(
+                   {"x", "a,b", "say \"\"hi\"\"", "1", "2"}));
+
+  View<std::string> v(s);
+  std::vector<char> delims;
+  auto sv = split(v, ",\n", split_mode::csv);
+  for (auto it = sv.begin(); it != sv.end(); ++it)
+    delims.push_back(it.delimiter());
+  REQUIRE(delims == std::vector<char>({',', ',', '\n', ',', '\0'}));
+}
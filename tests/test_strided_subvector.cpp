@@ -0,0 +1,90 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <algorithm>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+//
+#include <view_wrapper/parallel.hpp>
+#include <view_wrapper/strided_subvector.hpp>
+
+using view_wrapper::field_view;
+using view_wrapper::strided_subvector;
+
+namespace {
+struct particle {
+  float x;
+  float mass;
+  std::string name;
+};
+}  // namespace
+
+static_assert(std::ranges::random_access_range<field_view<&particle::mass>>);
+
+TEST_CASE("strided_subvector views every k-th element") {
+  std::vector<int> v(10);
+  std::iota(v.begin(), v.end(), 0);
+  strided_subvector<int> odd(v, 1, 5, 2);
+  REQUIRE(odd.size() == 5);
+  REQUIRE(odd[0] == 1);
+  REQUIRE(odd[4] == 9);
+  REQUIRE(odd.as_copy() == std::vector<int>{1, 3, 5, 7, 9});
+  REQUIRE(std::accumulate(odd.begin(), odd.end(), 0) == 25);
+  // write-through
+  for (auto& x : odd) x = -x;
+  REQUIRE(v[3] == -3);
+  REQUIRE(v[4] == 4);
+  // slice and composed stride
+  REQUIRE(odd.slice(1, 3).as_copy() == std::vector<int>{-3, -5});
+  REQUIRE(odd.strided(2).as_copy() == std::vector<int>{-1, -5, -9});
+  bool thrown = false;
+  try {
+    odd.strided(0);
+  } catch (const std::invalid_argument&) {
+    thrown = true;
+  }
+  REQUIRE(thrown);
+  std::ranges::sort(odd);
+  REQUIRE(odd.as_copy() == std::vector<int>{-9, -7, -5, -3, -1});
+  REQUIRE(v[0] == 0);
+  REQUIRE(v[1] == -9);
+}
+
+TEST_CASE("field_view projects one member of AoS") {
+  std::vector<particle> ps = {
+      {1.0f, 10.0f, "a"}, {2.0f, 20.0f, "b"}, {3.0f, 30.0f, "c"}};
+  field_view<&particle::mass> masses(ps);
+  REQUIRE(masses.size() == 3);
+  REQUIRE(masses[1] == 20.0f);
+  REQUIRE(std::accumulate(masses.begin(), masses.end(), 0.0f) == 60.0f);
+  masses[2] = 31.0f;
+  REQUIRE(ps[2].mass == 31.0f);
+  REQUIRE(masses.slice(1, 3).as_copy() == std::vector<float>{20.0f, 31.0f});
+
+  field_view<&particle::name> names(ps, 1, 3);
+  REQUIRE(names[0] == "b");
+  REQUIRE(std::ranges::find(names, "c") - names.begin() == 1);
+}
+
+TEST_CASE("strided and field views work with parallel algorithms") {
+  view_wrapper::thread_pool pool(2);
+  std::vector<particle> ps(1000, particle{0.0f, 1.0f, ""});
+  field_view<&particle::mass> masses(ps);
+  view_wrapper::parallel_for_each(masses, [](float& m) { m *= 2; }, 64,
+                                  pool);
+  REQUIRE(view_wrapper::parallel_reduce(masses, 0.0f, std::plus<>{}, 64,
+                                        pool) == 2000.0f);
+  std::vector<int> v(1000, 1);
+  strided_subvector<int> every3(v, 0, 334, 3);
+  REQUIRE(view_wrapper::parallel_reduce(every3, 0, std::plus<>{}, 16, pool) ==
+          334);
+}
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+//
+#include <view_wrapper/View.hpp>
+#include <view_wrapper/string_pool.hpp>
+
+using view_wrapper::interned_string;
+using view_wrapper::string_equal;
+using view_wrapper::string_hash;
+using view_wrapper::string_pool;
+using view_wrapper::View;
+
+TEST_CASE("string_pool interns each string once") {
+  string_pool pool;
+  std::string a = "user:42";
+  interned_string k1 = pool.intern(a);
+  interned_string k2 = pool.intern(std::string_view("user:42"));
+  a[0] = 'X';  // pool keeps its own copy
+  REQUIRE(k1.data() == k2.data());
+  REQUIRE(k1 == k2);
+  REQUIRE(k1 == std::string_view("user:42"));
+  REQUIRE(k1.hash() == std::hash<std::string_view>{}("user:42"));
+  REQUIRE(pool.size() == 1);
+  REQUIRE(pool.bytes_used() == 7);
+
+  // empty string is a valid (non-null) handle
+  interned_string e = pool.intern("");
+  REQUIRE(e.has_value());
+  REQUIRE(e.size() == 0);
+  REQUIRE(pool.find("").data() == e.data());
+
+  // find never inserts: missing strings give null handles
+  REQUIRE(!pool.find("missing").has_value());
+  REQUIRE(!pool.contains("missing"));
+  REQUIRE(pool.size() == 2);
+}
+
+TEST_CASE("string_pool handles stay valid while the pool grows") {
+  string_pool pool(64);
+  interned_string first = pool.intern("first");
+  for (int i = 0; i < 10000; i++) pool.intern("key:" + std::to_string(i));
+  REQUIRE(pool.size() == 10001);
+  REQUIRE(first == std::string_view("first"));
+  REQUIRE(pool.find("first").data() == first.data());
+  for (int i = 0; i < 10000; i += 997)
+    REQUIRE(pool.find("key:" + std::to_string(i)) ==
+            std::string_view("key:" + std::to_string(i)));
+  REQUIRE(pool.memory_bytes() >= pool.bytes_used());
+}
+
+TEST_CASE("interned_string and View<std::string> as hashed keys") {
+  string_pool pool;
+  std::unordered_map<interned_string, int, string_hash, string_equal> m;
+  m[pool.intern("alpha")] = 1;
+  m[pool.intern("beta")] = 2;
+  // heterogeneous lookups (no std::string is built)
+  REQUIRE(m.find(pool.intern("beta"))->second == 2);
+  REQUIRE(m.find(std::string_view("alpha"))->second == 1);
+  REQUIRE(m.find("beta")->second == 2);
+  REQUIRE(m.find(std::string("gamma")) == m.end());
+
+  // std::hash agrees with std::string_view for View and interned_string
+  std::string s = "alpha";
+  View<std::string> v(s);
+  REQUIRE(std::hash<View<std::string>>{}(v) ==
+          std::hash<std::string_view>{}("alpha"));
+  REQUIRE(std::hash<interned_string>{}(pool.intern("alpha")) ==
+          std::hash<View<std::string>>{}(v));
+  REQUIRE(v == std::string_view("alpha"));
+  REQUIRE(string_equal{}(v, pool.intern("alpha")));
+
+  std::unordered_set<View<std::string>> views;
+  views.insert(v);
+  std::string copy = "alpha";
+  REQUIRE(views.count(View<std::string>(copy)) == 1);
+}
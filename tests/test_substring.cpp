@@ -0,0 +1,123 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+//
+#include <view_wrapper/Range.hpp>
+#include <view_wrapper/substring.hpp>
+
+using view_wrapper::fixed_bounds;
+using view_wrapper::make_substring;
+using view_wrapper::Range;
+using view_wrapper::substring;
+
+TEST_CASE("substring replace writes through to owner") {
+  std::string page = "Hello, {{name}}!";
+  substring field(page, 7, 15);
+  REQUIRE(field.as_string_view() == "{{name}}");
+  field.replace(0, field.size(), "World");
+  REQUIRE(page == "Hello, World!");
+  REQUIRE(field == "World");
+  field.replace(0, 1, "w");
+  REQUIRE(page == "Hello, world!");
+  // count is clamped to substring end
+  field.replace(2, 100, "RLD");
+  REQUIRE(page == "Hello, woRLD!");
+  REQUIRE(field.size() == 5);
+}
+
+TEST_CASE("substring insert, append, erase and pop_back") {
+  std::string s = "key: value; other";
+  substring v(s, 5, 10);
+  v.insert(0, "new ");
+  REQUIRE(s == "key: new value; other");
+  v.append("s");
+  v += '!';
+  REQUIRE(v == "new values!");
+  REQUIRE(s == "key: new values!; other");
+  v.pop_back();
+  v.erase(0, 4);
+  REQUIRE(s == "key: values; other");
+  v.insert(v.size(), 2, '.');
+  REQUIRE(v.as_copy() == "values..");
+  v.clear();
+  REQUIRE(v.empty());
+  REQUIRE(s == "key: ; other");
+  v.assign("x");
+  REQUIRE(s == "key: x; other");
+}
+
+TEST_CASE("substring rejects positions past its end") {
+  std::string s = "key: value; other";
+  substring v(s, 5, 10);
+  bool thrown = false;
+  try {
+    v.erase(6);
+  } catch (const std::out_of_range&) {
+    thrown = true;
+  }
+  REQUIRE(thrown);
+  thrown = false;
+  try {
+    v.replace(6, 1, "x");
+  } catch (const std::out_of_range&) {
+    thrown = true;
+  }
+  REQUIRE(thrown);
+  thrown = false;
+  try {
+    v.insert(6, "x");
+  } catch (const std::out_of_range&) {
+    thrown = true;
+  }
+  REQUIRE(thrown);
+  REQUIRE(s == "key: value; other");
+  v.erase(5);  // pos == size is a no-op, as for std::string
+  REQUIRE(v == "value");
+}
+
+TEST_CASE("substring dynamic bounds and slices") {
+  std::string s = "GET /index.html HTTP/1.1";
+  auto path = [](const std::string& r) {
+    auto b = r.find(' ') + 1;
+    return std::make_pair(b, r.find(' ', b));
+  };
+  substring p(s, path);
+  REQUIRE(p == "/index.html");
+  s.insert(0, "XX");  // remote edit, bounds follow
+  REQUIRE(p.size() == 11);
+  REQUIRE(p.find(".html") == 6);
+
+  auto lam = make_substring(s, path);
+  lam.replace(1, 5, "home");
+  REQUIRE(s == "XXGET /home.html HTTP/1.1");
+  REQUIRE(p.size() == 10);
+  auto ext = p.slice(6, 10);
+  REQUIRE(ext.as_string_view() == "html");
+
+  view_wrapper::basic_substring<char, std::char_traits<char>,
+                                std::allocator<char>, fixed_bounds>
+      fixed(s);
+  REQUIRE(fixed.size() == s.size());
+}
+
+TEST_CASE("Range<std::string> edits through as_range") {
+  std::string s = "abc";
+  Range<std::string> r(s);
+  r->append("def");
+  REQUIRE(s == "abcdef");
+  REQUIRE(r.as_copy() == "abcdef");
+  REQUIRE(r.as_string_view() == "abcdef");
+  std::string out;
+  for (char c : r) out += c;
+  REQUIRE(out == "abcdef");
+}
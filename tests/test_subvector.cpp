@@ -0,0 +1,239 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+//
+#include <view_wrapper/subvector.hpp>
+
+using view_wrapper::fixed_bounds;
+using view_wrapper::fixed_subvector;
+using view_wrapper::full_bounds;
+using view_wrapper::make_subvector;
+using view_wrapper::subvector;
+
+TEST_CASE("subvector default policy keeps std::function behavior") {
+  std::vector<int> v = {1, 2, -1, 4, 5, 6};
+  subvector<int> vv1(v);
+  subvector<int> vv2(v, 0, 2);
+  subvector<int> vv3(v, [](const std::vector<int>& v) {
+    auto it1 = std::find(v.begin(), v.end(), -1);
+    auto idx1 = std::distance(v.begin(), it1);
+    return std::make_pair(idx1 + 1, v.size());
+  });
+  REQUIRE(vv1.size() == 6);
+  REQUIRE(vv2.size() == 2);
+  REQUIRE(vv3.size() == 3);
+  vv2.push_back(3);
+  REQUIRE(vv1.size() == 7);
+  REQUIRE(vv2.size() == 3);
+  REQUIRE(vv3.size() == 3);
+  REQUIRE(vv3[0] == 4);
+  // fixed subvector refresh is a no-op
+  vv2.refresh();
+  REQUIRE(vv2.size() == 3);
+  subvector<int> vv4 = vv1.slice(1, 3);
+  REQUIRE(vv4.size() == 2);
+  REQUIRE(vv4[0] == 2);
+}
+
+TEST_CASE("subvector full_bounds follows remote size") {
+  std::vector<int> v = {1, 2, 3};
+  subvector<int, std::allocator<int>, full_bounds> sv(v);
+  REQUIRE(sv.size() == 3);
+  v.push_back(4);
+  REQUIRE(sv.size() == 4);
+  sv.push_back(5);
+  REQUIRE(v.size() == 5);
+  REQUIRE(v.back() == 5);
+  subvector<int, std::allocator<int>, fixed_bounds> s2 = sv.slice(1, 3);
+  REQUIRE(s2.size() == 2);
+  REQUIRE(s2[0] == 2);
+}
+
+TEST_CASE("subvector fixed_bounds keeps bounds") {
+  std::vector<int> v = {1, 2, 3};
+  subvector<int, std::allocator<int>, fixed_bounds> sv(v);
+  v.push_back(4);
+  REQUIRE(sv.size() == 3);
+  sv.push_back(10);
+  REQUIRE(sv.size() == 4);
+  REQUIRE(v[3] == 10);
+}
+
+TEST_CASE("subvector pop_back removes its own last element") {
+  std::vector<int> v = {1, 2, 3, 4, 5};
+  subvector<int, std::allocator<int>, fixed_bounds> sv(v, 1, 3);
+  sv.pop_back();
+  REQUIRE(sv.size() == 1);
+  REQUIRE(sv[0] == 2);
+  REQUIRE(v == std::vector<int>({1, 2, 4, 5}));
+  subvector<int> whole(v);
+  whole.pop_back();
+  REQUIRE(v == std::vector<int>({1, 2, 4}));
+}
+
+TEST_CASE("subvector lambda_bounds via make_subvector") {
+  std::vector<int> v = {1, 2, -1, 4, 5, 6};
+  auto sv = make_subvector(v, [](const std::vector<int>& v) {
+    auto it1 = std::find(v.begin(), v.end(), -1);
+    return std::make_pair(std::distance(v.begin(), it1) + 1, v.size());
+  });
+  REQUIRE(sv.size() == 3);
+  v.insert(v.begin(), 0);
+  REQUIRE(sv.size() == 3);
+  REQUIRE(sv[0] == 4);
+  sv.push_back(7);
+  REQUIRE(v.back() == 7);
+  REQUIRE(sv.size() == 4);
+}
+
+TEST_CASE("fixed_subvector is compact and keeps fixed bounds") {
+  STATIC_REQUIRE(std::is_trivially_copyable<fixed_subvector<int>>::value);
+  std::vector<int> v = {1, 2, 3, 4, 5, 6};
+  fixed_subvector<int> sv(v, 1, 4);
+  REQUIRE(sv.size() == 3);
+  REQUIRE(sv[0] == 2);
+  sv.push_back(10);
+  REQUIRE(sv.size() == 4);
+  REQUIRE(v[4] == 10);
+  auto s2 = sv.slice(1, 3);
+  REQUIRE(s2.size() == 2);
+  REQUIRE(s2[0] == 3);
+  sv.pop_back();
+  REQUIRE(sv.size() == 3);
+  REQUIRE(v[4] == 5);
+  std::vector<fixed_subvector<int>> all;
+  for (int i = 0; i < 100; i++) all.push_back(fixed_subvector<int>(v, 0, 2));
+  REQUIRE(all[99].size() == 2);
+}
+
+TEST_CASE("fixed_subvector rejects indices beyond Index range") {
+  using small_subvector =
+      fixed_subvector<char, std::allocator<char>, std::uint8_t>;
+  std::vector<char> v(300, 'x');
+  bool thrown = false;
+  try {
+    small_subvector sv(v);
+  } catch (const std::length_error&) {
+    thrown = true;
+  }
+  REQUIRE(thrown);
+  thrown = false;
+  try {
+    small_subvector sv(v, 0, 256);
+  } catch (const std::length_error&) {
+    thrown = true;
+  }
+  REQUIRE(thrown);
+  small_subvector sv(v, 0, 255);
+  thrown = false;
+  try {
+    sv.push_back('y');
+  } catch (const std::length_error&) {
+    thrown = true;
+  }
+  REQUIRE(thrown);
+  REQUIRE(sv.size() == 255);
+  REQUIRE(v.size() == 300);
+}
+
+TEST_CASE("subvector bulk operations keep bounds") {
+  std::vector<int> v = {1, 2, 3, 4, 5, 6};
+  subvector<int> sv(v, 1, 3);  // 2 3
+  std::vector<int> src = {7, 8, 9};
+  sv.insert(sv.begin() + 1, src.begin(), src.end());
+  REQUIRE(sv.as_copy() == std::vector<int>({2, 7, 8, 9, 3}));
+  sv.insert(sv.end(), 2, 0);
+  REQUIRE(sv.as_copy() == std::vector<int>({2, 7, 8, 9, 3, 0, 0}));
+  sv.append_range(std::vector<int>{10, 11});
+  REQUIRE(sv.size() == 9);
+  REQUIRE(sv.back() == 11);
+  REQUIRE(v.front() == 1);
+  REQUIRE(v[10] == 4);
+
+  REQUIRE(sv.erase_if([](int x) { return x % 2 == 0; }) == 5);
+  REQUIRE(sv.as_copy() == std::vector<int>({7, 9, 3, 11}));
+  REQUIRE(erase_if(sv, [](int x) { return x > 10; }) == 1);
+  REQUIRE(v == std::vector<int>({1, 7, 9, 3, 4, 5, 6}));
+
+  sv.assign({5, 5});
+  REQUIRE(v == std::vector<int>({1, 5, 5, 4, 5, 6}));
+  sv.assign(4, 1);
+  REQUIRE(v == std::vector<int>({1, 1, 1, 1, 1, 4, 5, 6}));
+  sv.resize(1);
+  REQUIRE(v == std::vector<int>({1, 1, 4, 5, 6}));
+  sv.resize(3, 9);
+  REQUIRE(v == std::vector<int>({1, 1, 9, 9, 4, 5, 6}));
+  REQUIRE(sv.size() == 3);
+}
+
+TEST_CASE("subvector copy_into reuses capacity") {
+  std::vector<int> v = {1, 2, 3, 4, 5, 6};
+  subvector<int> sv(v, 1, 4);
+  std::vector<int> out;
+  out.reserve(16);
+  const int* buf = out.data();
+  sv.copy_into(out);
+  REQUIRE(out == std::vector<int>({2, 3, 4}));
+  REQUIRE(out.data() == buf);
+  // shrink and grow within capacity
+  fixed_subvector<int>(v, 0, 1).copy_into(out);
+  REQUIRE(out == std::vector<int>({1}));
+  fixed_subvector<int>(v).copy_into(out);
+  REQUIRE(out == v);
+  REQUIRE(out.data() == buf);
+
+  // output iterators: raw pointer (memcpy) and back_inserter
+  int raw[3] = {0, 0, 0};
+  REQUIRE(sv.copy_into(raw) == raw + 3);
+  REQUIRE(raw[2] == 4);
+  std::vector<int> appended = {0};
+  sv.copy_into(std::back_inserter(appended));
+  REQUIRE(appended == std::vector<int>({0, 2, 3, 4}));
+
+  // non-trivially copyable elements
+  std::vector<std::vector<int>> nested = {{1}, {2, 2}};
+  subvector<std::vector<int>> nsv(nested);
+  std::vector<std::vector<int>> nout;
+  nsv.copy_into(nout);
+  REQUIRE(nout == nested);
+
+  // trivially copyable, but not default-constructible
+  struct point {
+    int x;
+    explicit point(int _x) : x{_x} {}
+  };
+  std::vector<point> pts = {point{1}, point{2}, point{3}};
+  std::vector<point> pout;
+  fixed_subvector<point>(pts, 1, 3).copy_into(pout);
+  REQUIRE(pout.size() == 2);
+  REQUIRE(pout[1].x == 3);
+}
+
+TEST_CASE("subvector is a borrowed view for std::views pipelines") {
+  std::vector<int> v = {1, 2, 3, 4, 5, 6};
+  subvector<int> sv(v, 1, 5);  // 2 3 4 5
+  auto odd = sv | std::views::filter([](int x) { return x % 2 == 1; });
+  REQUIRE(std::ranges::distance(odd) == 2);
+  // iterators escape a temporary subvector (borrowed range)
+  auto it = std::ranges::find(fixed_subvector<int>(v, 1, 5), 5);
+  REQUIRE(it == v.begin() + 4);
+  auto first = std::ranges::begin(
+      subvector<int, std::allocator<int>, full_bounds>(v) |
+      std::views::drop(2));
+  REQUIRE(*first == 3);
+}
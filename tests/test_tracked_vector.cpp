@@ -0,0 +1,45 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+//
+#include <view_wrapper/tracked_vector.hpp>
+
+using view_wrapper::tracked_vector;
+
+TEST_CASE("tracked_vector skips refresh when unchanged") {
+  tracked_vector<int> tv = {1, 2, -1, 4, 5, 6};
+  auto vv3 = tv.track([](const std::vector<int>& v) {
+    auto it1 = std::find(v.begin(), v.end(), -1);
+    return std::make_pair(std::distance(v.begin(), it1) + 1, v.size());
+  });
+  REQUIRE(vv3.bounds().refresh_count() == 1);
+  for (int i = 0; i < 10; i++) REQUIRE(vv3.size() == 3);
+  REQUIRE(vv3.bounds().refresh_count() == 1);
+  REQUIRE(vv3.bounds().skip_count() == 10);
+
+  tv.insert(tv.begin(), 0);
+  REQUIRE(vv3.size() == 3);
+  REQUIRE(vv3[0] == 4);
+  REQUIRE(vv3.bounds().refresh_count() == 2);
+
+  // own writes invalidate cached bounds too
+  vv3.push_back(7);
+  REQUIRE(tv.as_vector().back() == 7);
+  REQUIRE(vv3.size() == 4);
+  REQUIRE(vv3.bounds().refresh_count() == 3);
+
+  // value writes are tracked through at()
+  tv.at(0) = -1;
+  REQUIRE(vv3.size() == 7);
+  REQUIRE(vv3[0] == 1);
+}
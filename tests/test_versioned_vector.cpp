@@ -0,0 +1,104 @@
+// SPDX-License-Identifier:  MIT
+// Copyright (C) 2024 - https://github.com/igormcoelho/view_wrapper
+
+#ifdef MAKE
+#include <catch2/catch.hpp>
+#else
+#include <catch2/catch_test_macros.hpp>
+#endif
+//
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+//
+#include <view_wrapper/versioned_vector.hpp>
+
+using view_wrapper::versioned_vector;
+
+TEST_CASE("versioned_vector snapshot is immutable across publish") {
+  versioned_vector<int> vv(std::vector<int>{1, 2, 3});
+  auto s0 = vv.snapshot();
+  REQUIRE(s0.has_value());
+  REQUIRE(s0.version() == 0);
+  REQUIRE(s0.size() == 3);
+
+  // unpublished edits are not visible
+  vv.edit().push_back(4);
+  REQUIRE(vv.snapshot().size() == 3);
+
+  // writer reallocates: old snapshot stays valid
+  for (int i = 0; i < 1000; i++) vv.edit().push_back(i);
+  REQUIRE(vv.publish() == 1);
+  REQUIRE(s0.size() == 3);
+  REQUIRE(s0[2] == 3);
+  REQUIRE(s0.as_copy() == std::vector<int>({1, 2, 3}));
+
+  auto s1 = vv.snapshot();
+  REQUIRE(s1.version() == 1);
+  REQUIRE(s1.size() == 1004);
+  REQUIRE((*s1)[3] == 4);
+}
+
+TEST_CASE("versioned_vector update and recycled buffers") {
+  versioned_vector<int> vv;
+  REQUIRE(vv.snapshot().empty());
+  for (int i = 1; i <= 10; i++) {
+    vv.update([i](std::vector<int>& w) { w.assign(i, i); });
+    auto s = vv.snapshot();
+    REQUIRE(s.version() == std::uint64_t(i));
+    REQUIRE(s.size() == std::size_t(i));
+    REQUIRE(std::accumulate(s.begin(), s.end(), 0) == i * i);
+  }
+}
+
+TEST_CASE("versioned_vector cached snapshot is reloaded only when stale") {
+  versioned_vector<int> vv(std::vector<int>{1});
+  versioned_vector<int>::snapshot_type cached;
+  REQUIRE(!cached.has_value());
+  REQUIRE(vv.snapshot(cached).size() == 1);
+  const int* first = cached.as_view().data();
+  // not stale: same buffer
+  REQUIRE(vv.snapshot(cached).as_view().data() == first);
+  vv.edit().push_back(2);
+  vv.publish();
+  REQUIRE(vv.snapshot(cached).version() == 1);
+  REQUIRE(cached.size() == 2);
+}
+
+TEST_CASE("versioned_vector readers under concurrent writer") {
+  // invariant of every version: all elements are equal to version
+  versioned_vector<long> vv(std::vector<long>(256, 0));
+  std::atomic<bool> stop{false};
+  std::atomic<int> bad{0};
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 3; r++)
+    readers.emplace_back([&, r] {
+      versioned_vector<long>::snapshot_type cached;
+      while (!stop.load()) {
+        auto s = (r == 0) ? vv.snapshot(cached) : vv.snapshot();
+        long v = static_cast<long>(s.version());
+        for (long x : *s)
+          if (x != v) bad++;
+      }
+    });
+  for (long ver = 1; ver <= 2000; ver++)
+    vv.update([ver](std::vector<long>& w) { w.assign(256 + ver % 7, ver); });
+  stop = true;
+  for (auto& th : readers) th.join();
+  REQUIRE(bad.load() == 0);
+  REQUIRE(vv.version() == 2000);
+}
+
+TEST_CASE("versioned_vector snapshots may outlive the vector") {
+  versioned_vector<int>::snapshot_type copy;
+  {
+    versioned_vector<int> vv(std::vector<int>{7, 8});
+    auto s = vv.snapshot();
+    vv.update([](std::vector<int>& w) { w.push_back(9); });
+    copy = s;  // second reference to version 0
+    REQUIRE(vv.snapshot().size() == 3);
+  }
+  REQUIRE(copy.version() == 0);
+  REQUIRE(copy.as_copy() == std::vector<int>({7, 8}));
+}
@@ -7,9 +7,112 @@
 #include <catch2/catch_test_macros.hpp>
 #endif
 //
+#include <algorithm>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+//
 #include <view_wrapper/View.hpp>
 
 TEST_CASE("Teste1") {
   int x = 10;
   REQUIRE(x == 12);
 }
+
+TEST_CASE("View is trivially copyable and pointer-sized-null") {
+  STATIC_REQUIRE(std::is_trivially_copyable_v<view_wrapper::View<std::string>>);
+  STATIC_REQUIRE(sizeof(view_wrapper::View<std::string>) ==
+                 sizeof(std::string_view));
+  STATIC_REQUIRE(
+      std::is_trivially_copyable_v<view_wrapper::View<std::vector<int>>>);
+  std::string s = "abcd";
+  view_wrapper::View<std::string> sv(s);
+  REQUIRE(sv.has_value());
+  std::vector<view_wrapper::View<std::string>> all;
+  for (int i = 0; i < 100; i++) all.push_back(sv);
+  REQUIRE(*all[99] == "abcd");
+  std::string_view null_sv;
+  view_wrapper::View<std::string> nv(null_sv);
+  REQUIRE(!nv.has_value());
+  std::vector<int> v = {1, 2, 3};
+  view_wrapper::View<std::vector<int>> vv(v);
+  REQUIRE(vv.has_value());
+  REQUIRE(vv.as_copy() == v);
+  std::vector<int> empty;
+  view_wrapper::View<std::vector<int>> ev(empty);
+  REQUIRE(ev.has_value());
+  REQUIRE(ev.begin() == ev.end());
+  REQUIRE(ev.as_copy().empty());
+  std::span<int> null_span;
+  view_wrapper::View<std::vector<int>> nvv(null_span);
+  REQUIRE(!nvv.has_value());
+}
+
+TEST_CASE("StableView survives reallocation of remote vector") {
+  STATIC_REQUIRE(
+      std::is_trivially_copyable_v<view_wrapper::StableView<std::vector<int>>>);
+  std::vector<int> v = {1, 2, 3, 4};
+  view_wrapper::StableView<std::vector<int>> all(v);
+  view_wrapper::StableView<std::vector<int>> mid(v, 1, 3);
+  REQUIRE(all.has_value());
+  REQUIRE(mid.size() == 2);
+  const int* before = v.data();
+  for (int i = 0; i < 1000; i++) v.push_back(i);
+  REQUIRE(v.data() != before);
+  // indices still refer to the same elements
+  REQUIRE(all.size() == 4);
+  REQUIRE(all[3] == 4);
+  REQUIRE(mid[0] == 2);
+  REQUIRE(mid.as_copy() == std::vector<int>({2, 3}));
+  REQUIRE(mid.as_view().data() == v.data() + 1);
+  int sum = 0;
+  for (int x : all) sum += x;
+  REQUIRE(sum == 10);
+}
+
+TEST_CASE("View copy_into and as_copy with allocator") {
+  std::string s = "abcd";
+  view_wrapper::View<std::string> sv(s);
+  std::string out;
+  out.reserve(64);
+  const char* buf = out.data();
+  sv.copy_into(out);
+  REQUIRE(out == "abcd");
+  REQUIRE(out.data() == buf);
+  REQUIRE(sv.as_copy(std::allocator<char>()) == "abcd");
+  char raw[4];
+  REQUIRE(sv.copy_into(raw) == raw + 4);
+  REQUIRE(std::string_view(raw, 4) == "abcd");
+
+  std::vector<double> v = {1.5, 2.5};
+  view_wrapper::View<std::vector<double>> vv(v);
+  std::vector<double> vout(8, 0.0);
+  vv.copy_into(vout);
+  REQUIRE(vout == v);
+  view_wrapper::StableView<std::vector<double>> stable(v, 1, 2);
+  stable.copy_into(vout);
+  REQUIRE(vout == std::vector<double>({2.5}));
+}
+
+TEST_CASE("View is a borrowed view for std::views pipelines") {
+  std::vector<int> v = {1, 2, 3, 4, 5, 6};
+  view_wrapper::View<std::vector<int>> vw(v);
+  // view is held by value in the pipeline (no ref_view/owning_view)
+  auto even3 = vw | std::views::filter([](int x) { return x % 2 == 0; }) |
+               std::views::transform([](int x) { return 3 * x; });
+  int sum = 0;
+  for (int x : even3) sum += x;
+  REQUIRE(sum == 36);
+  // iterators escape a temporary view (borrowed range, not dangling)
+  auto it = std::ranges::find(view_wrapper::View<std::vector<int>>(v), 4);
+  REQUIRE(&*it == &v[3]);
+  std::string s = "a,b";
+  auto comma = std::ranges::find(view_wrapper::View<std::string>(s), ',');
+  REQUIRE(*comma == ',');
+  view_wrapper::StableView<std::vector<int>> stable(v, 2, 4);
+  REQUIRE(std::ranges::distance(stable | std::views::reverse) == 2);
+}